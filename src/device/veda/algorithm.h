@@ -0,0 +1,325 @@
+#pragma once
+
+#include "omp.h"
+#include <cstring>
+#include <tuple>
+
+//------------------------------------------------------------------------------
+// Helpers
+//------------------------------------------------------------------------------
+inline size_t veda_omp_threads(void) {
+#ifdef _OPENMP
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+//------------------------------------------------------------------------------
+/** Splits cnt into one VLEN aligned chunk per thread and returns the number of
+ * chunks and the size of each chunk. All passes of an algorithm need to use the
+ * same chunks, so the per-chunk results of one pass match the next pass. Chunks
+ * are at least 256 elements, so cnt == 0 results in 0 chunks. */
+inline std::tuple<size_t, size_t> veda_omp_chunks(const size_t cnt) {
+	size_t step	= std::max(veda_omp_align_up((cnt + veda_omp_threads() - 1) / veda_omp_threads(), size_t(256)), size_t(256));
+	size_t chunks	= (cnt + step - 1) / step;
+	return std::make_tuple(chunks, step);
+}
+
+//------------------------------------------------------------------------------
+/** Runs func(chunk, min, max) for all chunks, one chunk per thread. */
+template<typename F>
+inline void veda_omp_chunked(const size_t cnt, F func) {
+	size_t chunks, step;
+	std::tie(chunks, step) = veda_omp_chunks(cnt);
+	veda_omp(chunks, [&](const size_t cmin, const size_t cmax) {
+		for(size_t c = cmin; c < cmax; c++)
+			func(c, c * step, std::min((c + 1) * step, cnt));
+	});
+}
+
+//------------------------------------------------------------------------------
+// Scan
+//------------------------------------------------------------------------------
+/** Computes the prefix sum of in into out. in and out may be the same. */
+template<bool Inclusive, typename T>
+inline void veda_omp_scan(const T* in, T* out, const size_t cnt) {
+	if(cnt == 0)
+		return;
+
+	size_t chunks, step;
+	std::tie(chunks, step) = veda_omp_chunks(cnt);
+	std::vector<T> sums(chunks + 1, T(0));
+
+	veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+		T sum = 0;
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			sum += in[i];
+		sums[c + 1] = sum;
+	});
+
+	for(size_t c = 0; c < chunks; c++)
+		sums[c + 1] += sums[c];
+
+	veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+		T sum = sums[c];
+		for(size_t i = min; i < max; i++) {
+			const T value = in[i];
+			if(Inclusive) {
+				sum	+= value;
+				out[i]	= sum;
+			} else {
+				out[i]	= sum;
+				sum	+= value;
+			}
+		}
+	});
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline void veda_omp_scan_inclusive(const T* in, T* out, const size_t cnt) {
+	veda_omp_scan<true>(in, out, cnt);
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline void veda_omp_scan_exclusive(const T* in, T* out, const size_t cnt) {
+	veda_omp_scan<false>(in, out, cnt);
+}
+
+//------------------------------------------------------------------------------
+// Compaction
+//------------------------------------------------------------------------------
+/** Copies all in[i] for which pred(i) is true to out, keeping their order, and
+ * returns the number of copied elements. in and out must not overlap. */
+template<typename T, typename P>
+inline size_t veda_omp_compact_if(const T* in, T* out, const size_t cnt, P pred) {
+	if(cnt == 0)
+		return 0;
+
+	size_t chunks, step;
+	std::tie(chunks, step) = veda_omp_chunks(cnt);
+	std::vector<size_t> offsets(chunks + 1, 0);
+
+	veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+		size_t n = 0;
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			n += pred(i) ? 1 : 0;
+		offsets[c + 1] = n;
+	});
+
+	for(size_t c = 0; c < chunks; c++)
+		offsets[c + 1] += offsets[c];
+
+	veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+		size_t o = offsets[c];
+		for(size_t i = min; i < max; i++)
+			if(pred(i))
+				out[o++] = in[i];
+	});
+
+	return offsets[chunks];
+}
+
+//------------------------------------------------------------------------------
+/** Copies all in[i] with mask[i] != 0 to out. See veda_omp_compact_if. */
+template<typename T>
+inline size_t veda_omp_compact(const T* in, const uint8_t* mask, T* out, const size_t cnt) {
+	return veda_omp_compact_if(in, out, cnt, [=](const size_t i) { return mask[i] != 0; });
+}
+
+//------------------------------------------------------------------------------
+// Histogram
+//------------------------------------------------------------------------------
+/** Counts how often each value in [0, nbins) occurs in in and stores the
+ * result in bins. Values outside of this range are ignored. */
+template<typename T>
+inline void veda_omp_histogram(const T* in, const size_t cnt, uint64_t* bins, const size_t nbins) {
+	static_assert(std::is_integral<T>::value);
+	if(nbins == 0)
+		return;
+
+	size_t chunks, step;
+	std::tie(chunks, step) = veda_omp_chunks(cnt);
+	std::vector<uint64_t> local(std::max(chunks, size_t(1)) * nbins, 0);
+
+	veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+		auto hist = local.data() + c * nbins;
+		for(size_t i = min; i < max; i++) {
+			const T value = in[i];
+			if constexpr (std::is_signed<T>::value)
+				if(value < T(0))
+					continue;
+			if(uint64_t(value) < nbins)
+				hist[value]++;
+		}
+	});
+
+	veda_omp_simd(nbins, [&](const size_t min, const size_t max) {
+		#pragma _NEC vector
+		for(size_t b = min; b < max; b++)
+			bins[b] = 0;
+		for(size_t c = 0; c < chunks; c++) {
+			auto hist = local.data() + c * nbins;
+			#pragma _NEC vector
+			for(size_t b = min; b < max; b++)
+				bins[b] += hist[b];
+		}
+	});
+}
+
+//------------------------------------------------------------------------------
+// Radix Sort
+//------------------------------------------------------------------------------
+/** Maps keys to unsigned integers with the same ordering. */
+template<typename T> struct veda_radix_traits;
+
+template<> struct veda_radix_traits<uint32_t> {
+	typedef uint32_t U;
+	static inline U		to	(const uint32_t x)	{ return x;	}
+	static inline uint32_t	from	(const U x)		{ return x;	}
+};
+
+template<> struct veda_radix_traits<uint64_t> {
+	typedef uint64_t U;
+	static inline U		to	(const uint64_t x)	{ return x;	}
+	static inline uint64_t	from	(const U x)		{ return x;	}
+};
+
+template<> struct veda_radix_traits<int32_t> {
+	typedef uint32_t U;
+	static inline U		to	(const int32_t x)	{ return U(x) ^ 0x80000000u;		}
+	static inline int32_t	from	(const U x)		{ return int32_t(x ^ 0x80000000u);	}
+};
+
+template<> struct veda_radix_traits<int64_t> {
+	typedef uint64_t U;
+	static inline U		to	(const int64_t x)	{ return U(x) ^ 0x8000000000000000llu;		}
+	static inline int64_t	from	(const U x)		{ return int64_t(x ^ 0x8000000000000000llu);	}
+};
+
+template<> struct veda_radix_traits<float> {
+	typedef uint32_t U;
+	static inline U to(const float x) {
+		U u; memcpy(&u, &x, sizeof(U));
+		return (u & 0x80000000u) ? ~u : (u | 0x80000000u);
+	}
+	static inline float from(const U x) {
+		U u = (x & 0x80000000u) ? (x ^ 0x80000000u) : ~x;
+		float f; memcpy(&f, &u, sizeof(U));
+		return f;
+	}
+};
+
+template<> struct veda_radix_traits<double> {
+	typedef uint64_t U;
+	static inline U to(const double x) {
+		U u; memcpy(&u, &x, sizeof(U));
+		return (u & 0x8000000000000000llu) ? ~u : (u | 0x8000000000000000llu);
+	}
+	static inline double from(const U x) {
+		U u = (x & 0x8000000000000000llu) ? (x ^ 0x8000000000000000llu) : ~x;
+		double d; memcpy(&d, &u, sizeof(U));
+		return d;
+	}
+};
+
+//------------------------------------------------------------------------------
+/** Stable LSD radix sort with 8 bit digits. Each pass builds a histogram per
+ * chunk, computes the digit-major offsets of all chunks and scatters the keys.
+ * Passes in which all keys share the same digit get skipped. values can be
+ * null. */
+template<typename K, typename V>
+inline void veda_omp_radix_sort_impl(K* keys, V* values, const size_t cnt) {
+	typedef veda_radix_traits<K>	Traits;
+	typedef typename Traits::U	U;
+	constexpr size_t RADIX = 256;
+
+	if(cnt < 2)
+		return;
+
+	std::vector<U> ka(cnt), kb(cnt);
+	std::vector<V> va(values ? cnt : 0), vb(values ? cnt : 0);
+
+	veda_omp_simd(cnt, [&](const size_t min, const size_t max) {
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			ka[i] = Traits::to(keys[i]);
+		if(values)
+			memcpy(va.data() + min, values + min, (max - min) * sizeof(V));
+	});
+
+	size_t chunks, step;
+	std::tie(chunks, step) = veda_omp_chunks(cnt);
+	std::vector<size_t> hist(chunks * RADIX);
+
+	U* src	= ka.data();
+	U* dst	= kb.data();
+	V* vsrc	= va.data();
+	V* vdst	= vb.data();
+
+	for(size_t shift = 0; shift < sizeof(U) * 8; shift += 8) {
+		veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+			auto h = hist.data() + c * RADIX;
+			for(size_t d = 0; d < RADIX; d++)
+				h[d] = 0;
+			for(size_t i = min; i < max; i++)
+				h[(src[i] >> shift) & 0xFF]++;
+		});
+
+		// digit-major exclusive scan over all chunks
+		size_t sum = 0;
+		bool skip = false;
+		for(size_t d = 0; d < RADIX && !skip; d++) {
+			size_t total = 0;
+			for(size_t c = 0; c < chunks; c++) {
+				auto n = hist[c * RADIX + d];
+				hist[c * RADIX + d] = sum;
+				sum	+= n;
+				total	+= n;
+			}
+			skip = total == cnt;
+		}
+		if(skip)
+			continue;
+
+		veda_omp_chunked(cnt, [&](const size_t c, const size_t min, const size_t max) {
+			auto h = hist.data() + c * RADIX;
+			for(size_t i = min; i < max; i++) {
+				auto o = h[(src[i] >> shift) & 0xFF]++;
+				dst[o] = src[i];
+				if(values)
+					vdst[o] = vsrc[i];
+			}
+		});
+
+		std::swap(src, dst);
+		std::swap(vsrc, vdst);
+	}
+
+	veda_omp_simd(cnt, [&](const size_t min, const size_t max) {
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			keys[i] = Traits::from(src[i]);
+		if(values)
+			memcpy(values + min, vsrc + min, (max - min) * sizeof(V));
+	});
+}
+
+//------------------------------------------------------------------------------
+/** Sorts keys ascending. Supports int32_t, int64_t, uint32_t, uint64_t, float
+ * and double. */
+template<typename K>
+inline void veda_omp_radix_sort(K* keys, const size_t cnt) {
+	veda_omp_radix_sort_impl(keys, (uint8_t*)0, cnt);
+}
+
+//------------------------------------------------------------------------------
+/** Sorts keys ascending and applies the same permutation to values. */
+template<typename K, typename V>
+inline void veda_omp_radix_sort_pairs(K* keys, V* values, const size_t cnt) {
+	veda_omp_radix_sort_impl(keys, values, cnt);
+}
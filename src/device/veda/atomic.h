@@ -0,0 +1,291 @@
+#pragma once
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+/** Alignment of contended fields, matches the LLC cache line size of the VE. */
+#define VEDA_ATOMIC_ALIGN 128
+
+/** Number of busy-wait iterations after which VEDAbackoff starts to yield. */
+#define VEDA_BACKOFF_SPIN_MAX 1024
+
+//------------------------------------------------------------------------------
+// Atomics
+//------------------------------------------------------------------------------
+/** Wrappers around the __atomic builtins. Unlike std::atomic they operate on
+ * plain memory, so they can be used on buffers allocated by the host, e.g.,
+ * counters shared between the streams of a VEDA_CONTEXT_MODE_SCALAR context.
+ * order is one of the __ATOMIC_* memory orders. */
+template<typename T>
+inline T veda_atomic_load(const T* ptr, const int order = __ATOMIC_SEQ_CST) {
+	return __atomic_load_n(ptr, order);
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline void veda_atomic_store(T* ptr, const T value, const int order = __ATOMIC_SEQ_CST) {
+	__atomic_store_n(ptr, value, order);
+}
+
+//------------------------------------------------------------------------------
+/** Adds value to *ptr and returns the previous value. */
+template<typename T>
+inline T veda_atomic_add(T* ptr, const T value, const int order = __ATOMIC_SEQ_CST) {
+	return __atomic_fetch_add(ptr, value, order);
+}
+
+//------------------------------------------------------------------------------
+/** Subtracts value from *ptr and returns the previous value. */
+template<typename T>
+inline T veda_atomic_sub(T* ptr, const T value, const int order = __ATOMIC_SEQ_CST) {
+	return __atomic_fetch_sub(ptr, value, order);
+}
+
+//------------------------------------------------------------------------------
+/** Stores value in *ptr and returns the previous value. */
+template<typename T>
+inline T veda_atomic_exchange(T* ptr, const T value, const int order = __ATOMIC_SEQ_CST) {
+	return __atomic_exchange_n(ptr, value, order);
+}
+
+//------------------------------------------------------------------------------
+/** Stores desired in *ptr if it equals expected. Otherwise expected gets
+ * updated with the current value and false gets returned. */
+template<typename T>
+inline bool veda_atomic_cas(T* ptr, T& expected, const T desired, const int order = __ATOMIC_SEQ_CST) {
+	const int failure = order == __ATOMIC_ACQ_REL ? __ATOMIC_ACQUIRE : order == __ATOMIC_RELEASE ? __ATOMIC_RELAXED : order;
+	return __atomic_compare_exchange_n(ptr, &expected, desired, false, order, failure);
+}
+
+//------------------------------------------------------------------------------
+inline void veda_atomic_fence(const int order = __ATOMIC_SEQ_CST) {
+	__atomic_thread_fence(order);
+}
+
+//------------------------------------------------------------------------------
+// Backoff
+//------------------------------------------------------------------------------
+/** Exponential backoff for spin loops. Busy-waits for 1, 2, 4, ... iterations
+ * and yields the core once VEDA_BACKOFF_SPIN_MAX got exceeded, so waiting
+ * threads don't starve the thread they wait for if cores are oversubscribed. */
+class VEDAbackoff {
+	uint32_t m_spins;
+
+public:
+	inline VEDAbackoff(void) : m_spins(1) {}
+
+	inline void pause(void) {
+		if(m_spins <= VEDA_BACKOFF_SPIN_MAX) {
+			for(uint32_t i = 0; i < m_spins; i++)
+				asm volatile("" ::: "memory");
+			m_spins <<= 1;
+		} else {
+			std::this_thread::yield();
+		}
+	}
+
+	inline void reset(void) {
+		m_spins = 1;
+	}
+};
+
+//------------------------------------------------------------------------------
+// Ticket Lock
+//------------------------------------------------------------------------------
+/** FIFO fair spin lock. Waiters only read the serving counter, which lives on
+ * its own cache line, so taking a ticket does not disturb the lock holder.
+ * Provides lock, try_lock and unlock, so it can be used with std::lock_guard
+ * and std::unique_lock. */
+class VEDAticketLock {
+	alignas(VEDA_ATOMIC_ALIGN) uint64_t m_next;
+	alignas(VEDA_ATOMIC_ALIGN) uint64_t m_serving;
+
+public:
+	inline VEDAticketLock(void) :
+		m_next		(0),
+		m_serving	(0)
+	{}
+
+	VEDAticketLock	(const VEDAticketLock&) = delete;
+	VEDAticketLock&	operator=(const VEDAticketLock&) = delete;
+
+	inline void lock(void) {
+		const uint64_t ticket = veda_atomic_add(&m_next, uint64_t(1), __ATOMIC_RELAXED);
+		VEDAbackoff backoff;
+		while(veda_atomic_load(&m_serving, __ATOMIC_ACQUIRE) != ticket)
+			backoff.pause();
+	}
+
+	inline bool try_lock(void) {
+		uint64_t ticket = veda_atomic_load(&m_serving, __ATOMIC_RELAXED);
+		return veda_atomic_cas(&m_next, ticket, ticket + 1, __ATOMIC_ACQUIRE);
+	}
+
+	inline void unlock(void) {
+		veda_atomic_store(&m_serving, m_serving + 1, __ATOMIC_RELEASE);
+	}
+};
+
+//------------------------------------------------------------------------------
+// Spin Barrier
+//------------------------------------------------------------------------------
+/** Reusable barrier for a fixed number of threads. The last arriving thread
+ * resets the counter and advances the generation, all other threads spin on
+ * the generation with backoff. */
+class VEDAspinBarrier {
+	alignas(VEDA_ATOMIC_ALIGN) uint32_t m_count;
+	alignas(VEDA_ATOMIC_ALIGN) uint32_t m_generation;
+	const uint32_t m_threads;
+
+public:
+	inline explicit VEDAspinBarrier(const uint32_t threads) :
+		m_count		(0),
+		m_generation	(0),
+		m_threads	(threads)
+	{}
+
+	VEDAspinBarrier		(const VEDAspinBarrier&) = delete;
+	VEDAspinBarrier&	operator=(const VEDAspinBarrier&) = delete;
+
+	/** Blocks until all threads arrived. Returns true for exactly one thread
+	 * per generation. */
+	inline bool wait(void) {
+		const uint32_t generation = veda_atomic_load(&m_generation, __ATOMIC_ACQUIRE);
+		if(veda_atomic_add(&m_count, uint32_t(1), __ATOMIC_ACQ_REL) == m_threads - 1) {
+			veda_atomic_store(&m_count, uint32_t(0), __ATOMIC_RELAXED);
+			veda_atomic_add(&m_generation, uint32_t(1), __ATOMIC_RELEASE);
+			return true;
+		}
+
+		VEDAbackoff backoff;
+		while(veda_atomic_load(&m_generation, __ATOMIC_ACQUIRE) == generation)
+			backoff.pause();
+		return false;
+	}
+
+	inline uint32_t threads(void) const {
+		return m_threads;
+	}
+};
+
+//------------------------------------------------------------------------------
+// Bounded MPMC Queue
+//------------------------------------------------------------------------------
+/** Lock-free bounded multi-producer/multi-consumer queue. Every cell carries a
+ * sequence number that tells producers and consumers whether the cell is free
+ * or filled for their position, so each operation only needs a single CAS on
+ * the head or tail. Cells are cache line aligned to avoid false sharing between
+ * neighbouring positions. The capacity gets rounded up to a power of 2. T needs
+ * to be default constructible and move assignable. */
+template<typename T>
+class VEDAqueue {
+	struct alignas(VEDA_ATOMIC_ALIGN) Cell {
+		size_t	seq;
+		T	value;
+	};
+
+	Cell*					m_cells;
+	size_t					m_mask;
+	alignas(VEDA_ATOMIC_ALIGN) size_t	m_head;
+	alignas(VEDA_ATOMIC_ALIGN) size_t	m_tail;
+
+	static inline size_t roundup(const size_t capacity) {
+		size_t cnt = 2;
+		while(cnt < capacity)
+			cnt <<= 1;
+		return cnt;
+	}
+
+public:
+	inline explicit VEDAqueue(const size_t capacity) :
+		m_cells	(new Cell[roundup(capacity)]),
+		m_mask	(roundup(capacity) - 1),
+		m_head	(0),
+		m_tail	(0)
+	{
+		for(size_t i = 0; i <= m_mask; i++)
+			m_cells[i].seq = i;
+	}
+
+	inline ~VEDAqueue(void) {
+		delete[] m_cells;
+	}
+
+	VEDAqueue	(const VEDAqueue&) = delete;
+	VEDAqueue&	operator=(const VEDAqueue&) = delete;
+
+	/** Returns false if the queue is full. */
+	template<typename V>
+	inline bool try_push(V&& value) {
+		size_t pos = veda_atomic_load(&m_head, __ATOMIC_RELAXED);
+		while(true) {
+			Cell& cell		= m_cells[pos & m_mask];
+			const size_t seq	= veda_atomic_load(&cell.seq, __ATOMIC_ACQUIRE);
+			const intptr_t diff	= intptr_t(seq) - intptr_t(pos);
+			if(diff == 0) {
+				if(veda_atomic_cas(&m_head, pos, pos + 1, __ATOMIC_RELAXED)) {
+					cell.value = std::forward<V>(value);
+					veda_atomic_store(&cell.seq, pos + 1, __ATOMIC_RELEASE);
+					return true;
+				}
+			} else if(diff < 0) {
+				return false;
+			} else {
+				pos = veda_atomic_load(&m_head, __ATOMIC_RELAXED);
+			}
+		}
+	}
+
+	/** Returns false if the queue is empty. */
+	inline bool try_pop(T& value) {
+		size_t pos = veda_atomic_load(&m_tail, __ATOMIC_RELAXED);
+		while(true) {
+			Cell& cell		= m_cells[pos & m_mask];
+			const size_t seq	= veda_atomic_load(&cell.seq, __ATOMIC_ACQUIRE);
+			const intptr_t diff	= intptr_t(seq) - intptr_t(pos + 1);
+			if(diff == 0) {
+				if(veda_atomic_cas(&m_tail, pos, pos + 1, __ATOMIC_RELAXED)) {
+					value = std::move(cell.value);
+					veda_atomic_store(&cell.seq, pos + m_mask + 1, __ATOMIC_RELEASE);
+					return true;
+				}
+			} else if(diff < 0) {
+				return false;
+			} else {
+				pos = veda_atomic_load(&m_tail, __ATOMIC_RELAXED);
+			}
+		}
+	}
+
+	/** Spins with backoff until the value could be pushed. */
+	template<typename V>
+	inline void push(V&& value) {
+		VEDAbackoff backoff;
+		while(!try_push(std::forward<V>(value)))
+			backoff.pause();
+	}
+
+	/** Spins with backoff until a value could be popped. */
+	inline T pop(void) {
+		T value;
+		VEDAbackoff backoff;
+		while(!try_pop(value))
+			backoff.pause();
+		return value;
+	}
+
+	inline size_t capacity(void) const {
+		return m_mask + 1;
+	}
+
+	/** Number of elements, only exact if no other thread modifies the queue. */
+	inline size_t size(void) const {
+		const size_t tail = veda_atomic_load(&m_tail, __ATOMIC_RELAXED);
+		const size_t head = veda_atomic_load(&m_head, __ATOMIC_RELAXED);
+		return head > tail ? head - tail : 0;
+	}
+};
+#endif
@@ -17,15 +17,19 @@
 #define __global__
 #endif
 
+__global__	VEDAresult	vedaChannelPush		(void* channel, const void* record);
+__global__	VEDAresult	vedaChannelTryPush	(void* channel, const void* record);
 __global__	VEDAresult	vedaGetErrorName	(VEDAresult error, const char** pStr);
 __global__	VEDAresult	vedaGetErrorString	(VEDAresult error, const char** pStr);
 __global__	VEDAresult	vedaMemAlloc		(VEDAdeviceptr vptr, const size_t size);
 __global__	VEDAresult	vedaMemAllocPtr		(void** ptr, VEDAdeviceptr vptr, const size_t size);
+__global__	VEDAresult	vedaMemAllocPtrEx	(void** ptr, VEDAdeviceptr vptr, const size_t size, const VEDAmem_placement placement, const int node);
 __global__	VEDAresult	vedaMemPtr		(void** ptr, VEDAdeviceptr vptr);
 __global__	VEDAresult	vedaMemPtrSize		(void** ptr, size_t* size, VEDAdeviceptr vptr);
 __global__	VEDAresult	vedaMemSize		(size_t* size, VEDAdeviceptr vptr);
 __global__	VEDAresult	vedaMemSwap		(VEDAdeviceptr A, VEDAdeviceptr B);
 __global__	VEDAresult	vedaMemcpy		(void* dst, const void* src, const size_t bytes);
+__global__	VEDAresult	vedaMemcpyNonTemporal	(void* dst, const void* src, const size_t bytes);
 __global__	VEDAresult	vedaMemsetD128		(void* ptr, const uint64_t x, const uint64_t y, const size_t cnt);
 __global__	VEDAresult	vedaMemsetD16		(void* ptr, const uint16_t value, const size_t cnt);
 __global__	VEDAresult	vedaMemsetD2D128	(void* ptr, const size_t pitch, const uint64_t x, const uint64_t y, const size_t w, const size_t h);
@@ -34,7 +38,30 @@ __global__	VEDAresult	vedaMemsetD2D32		(void* ptr, const size_t pitch, const uin
 __global__	VEDAresult	vedaMemsetD2D64		(void* ptr, const size_t pitch, const uint64_t value, const size_t w, const size_t h);
 __global__	VEDAresult	vedaMemsetD2D8		(void* ptr, const size_t pitch, const uint8_t  value, const size_t w, const size_t h);
 __global__	VEDAresult	vedaMemsetD32		(void* ptr, const uint32_t value, const size_t cnt);
+__global__	VEDAresult	vedaMemsetD3D8		(void* ptr, const size_t pitch, const size_t slicePitch, const uint8_t value, const size_t w, const size_t h, const size_t d);
 __global__	VEDAresult	vedaMemsetD64		(void* ptr, const uint64_t value, const size_t cnt);
+__global__	VEDAresult	vedaMemsetD64NonTemporal(void* ptr, const uint64_t value, const size_t cnt);
 __global__	VEDAresult	vedaMemsetD8		(void* ptr, const uint8_t  value, const size_t cnt);
+__global__	VEDAresult	vedaMemsetD8NonTemporal	(void* ptr, const uint8_t  value, const size_t cnt);
+__global__	size_t		vedaScratchMark		(void);
+__global__	void		vedaScratchReset	(const size_t mark);
+__global__	void*		vedaScratchAlloc	(const size_t bytes);
+
+#ifdef __cplusplus
+/** Releases all scratch memory that got allocated during its lifetime. Create
+ * one at the beginning of a kernel to reset the scratch arena of the stream
+ * when the kernel returns. alloc returns 0 if the arena is exhausted, in that
+ * case either fall back to malloc or increase VEDA_LIMIT_SCRATCH. */
+class VEDAscratch {
+	const size_t m_mark;
+
+public:
+	inline	VEDAscratch	(void)			: m_mark(vedaScratchMark())	{}
+	inline	~VEDAscratch	(void)			{ vedaScratchReset(m_mark);	}
+
+	template<typename T = char>
+	inline	T*	alloc	(const size_t cnt)	{ return (T*)vedaScratchAlloc(cnt * sizeof(T));	}
+};
+#endif
 
 #include <veda/ptr.h>
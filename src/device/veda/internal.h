@@ -2,6 +2,7 @@
 
 #include "device.h"
 #include "omp.h"
+#include "algorithm.h"
 #include <veda/internal_types.h>
 #include <unordered_map>
 #include <cstring>
@@ -10,12 +11,22 @@
 #define MAP_EMPLACE(KEY, ...) std::piecewise_construct, std::forward_as_tuple(KEY), std::forward_as_tuple(__VA_ARGS__)
 
 __global__	VEDAresult	vedaMemFree		(VEDAdeviceptr vptr);
+__global__	VEDAresult	veda_compact		(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, const size_t cnt, const VEDAdtype dtype, VEDAdeviceptr pcnt);
+__global__	VEDAresult	veda_histogram		(VEDAdeviceptr bins, const size_t nbins, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype);
+__global__	VEDAresult	veda_scan		(VEDAdeviceptr dst, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype, const int32_t inclusive);
+__global__	VEDAresult	veda_sort		(VEDAdeviceptr keys, VEDAdeviceptr values, const size_t cnt, const VEDAdtype dtype);
+__global__	size_t		veda_ctx_get_limit	(const VEDAlimit limit);
+__global__	VEDAresult	veda_ctx_set_limit	(const VEDAlimit limit, const size_t value);
+__global__	VEDAresult	veda_ctx_tune_limits	(uint32_t* untuned);
 __global__	VEDAresult	veda_mem_alloc		(VEDAdeviceptr vptr, const size_t size);
+__global__	VEDAresult	veda_mem_alloc_ex	(VEDAdeviceptr vptr, const size_t size, const VEDAmem_placement placement, const int32_t node);
 __global__	VEDAresult	veda_mem_free		(VEDAdeviceptr vptr);
 __global__	void*		veda_mem_ptr		(VEDAdeviceptr vptr);
 __global__	size_t		veda_mem_size		(VEDAdeviceptr vptr);
 __global__	VEDAresult	veda_mem_swap		(VEDAdeviceptr A, VEDAdeviceptr B);
 __global__	VEDAresult	veda_memcpy_d2d		(VEDAdeviceptr dst, VEDAdeviceptr src, const size_t size);
+__global__	VEDAresult	veda_memops		(const VEDAmemop* ops, const int32_t n);
+__global__	VEDAresult	veda_persistent		(void* ring, const uint64_t start, const int32_t profile);
 __global__	VEDAresult	veda_memset_u128	(VEDAdeviceptr dst, const uint64_t x, const uint64_t y, const size_t size);
 __global__	VEDAresult	veda_memset_u128_2d	(VEDAdeviceptr dst, const size_t pitch, const uint64_t x, const uint64_t y, const size_t w, const size_t h);
 __global__	VEDAresult	veda_memset_u16		(VEDAdeviceptr dst, const uint16_t value, const size_t size);
@@ -26,3 +37,4 @@ __global__	VEDAresult	veda_memset_u64		(VEDAdeviceptr dst, const uint64_t value,
 __global__	VEDAresult	veda_memset_u64_2d	(VEDAdeviceptr dst, const size_t pitch, const uint64_t value, const size_t w, const size_t h);
 __global__	VEDAresult	veda_memset_u8		(VEDAdeviceptr dst, const uint8_t value, const size_t size);
 __global__	VEDAresult	veda_memset_u8_2d	(VEDAdeviceptr dst, const size_t pitch, const uint8_t value, const size_t w, const size_t h);
+__global__	VEDAresult	veda_memset_u8_3d	(VEDAdeviceptr dst, const size_t pitch, const size_t slicePitch, const uint8_t value, const size_t w, const size_t h, const size_t d);
@@ -1,16 +1,60 @@
 #pragma once
 
 #ifdef __cplusplus
+#include <cstdint>
+#include <cstddef>
 #include <functional>
 #include <type_traits>
 #include <cassert>
 #include <algorithm>
+#include <limits>
+#include <vector>
+#include <atomic>
 
 template<typename T>	inline	size_t veda_omp_vlen		(void)	{ return 512; }
 template<>		inline	size_t veda_omp_vlen<int64_t>	(void)	{ return 256; }
 template<>		inline	size_t veda_omp_vlen<uint64_t>	(void)	{ return 256; }
 template<>		inline	size_t veda_omp_vlen<double>	(void)	{ return 256; }
 
+/** Size of a LLC cache line of the VE */
+#define VEDA_OMP_CACHELINE 128
+
+/** Working set of a single tile of veda_omp_2d/veda_omp_3d if the LLC size is
+ * unknown, see veda_omp_tile_bytes. */
+#define VEDA_OMP_TILE_BYTES (1024 * 1024)
+
+/** Vector length used to align the inner dimension of tiles. */
+#define VEDA_OMP_TILE_VLEN 256
+
+//------------------------------------------------------------------------------
+/** Scheduling of veda_omp and veda_omp_simd:
+ * STATIC:	each thread gets one equally sized range (default)
+ * DYNAMIC:	threads fetch chunks from a shared atomic counter
+ * GUIDED:	like DYNAMIC, but chunks shrink with the remaining work
+ * STEAL:	each thread processes its static range in chunks, and then
+ *		steals chunks from the ranges of the other threads */
+enum veda_omp_sched {
+	VEDA_OMP_SCHED_STATIC,
+	VEDA_OMP_SCHED_DYNAMIC,
+	VEDA_OMP_SCHED_GUIDED,
+	VEDA_OMP_SCHED_STEAL
+};
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline T veda_omp_align_up(const T value, const T align) {
+	return ((value + align - 1) / align) * align;
+}
+
+//------------------------------------------------------------------------------
+/** Per-thread partial result of veda_omp_simd_reduce. Each partial uses its
+ * own cache line, so the threads don't invalidate each other's lines. */
+template<typename M>
+struct alignas(VEDA_OMP_CACHELINE) veda_omp_partial {
+	M	value;
+	bool	valid;
+};
+
 //------------------------------------------------------------------------------
 // WITH OPENMP
 //------------------------------------------------------------------------------
@@ -79,8 +123,71 @@ public:
 };
 
 //------------------------------------------------------------------------------
-template<typename T, typename F>
-inline void veda_omp(const T cnt, F func) {
+template<typename T>
+struct alignas(VEDA_OMP_CACHELINE) veda_omp_steal_range {
+	std::atomic<T>	next;
+	T		end;
+};
+
+//------------------------------------------------------------------------------
+/** Runs func over [0, cnt) using a dynamic schedule S. All ranges passed to
+ * func start at a multiple of align, chunk is the (minimal) chunk size. If
+ * chunk is 0, the work gets split into 8 chunks per thread. */
+template<veda_omp_sched S, typename T, typename F>
+inline void veda_omp_dynamic(const T cnt, F func, const T align, T chunk) {
+	static_assert(S != VEDA_OMP_SCHED_STATIC);
+	T nthreads = omp_get_max_threads();
+	if(chunk <= 0)
+		chunk = std::max(T(1), cnt / (nthreads * 8));
+	chunk = veda_omp_align_up(chunk, align);
+
+	if constexpr (S == VEDA_OMP_SCHED_DYNAMIC) {
+		std::atomic<T> next(0);
+		#pragma omp parallel
+		{
+			for(T min = next.fetch_add(chunk); min < cnt; min = next.fetch_add(chunk))
+				func(min, std::min(min + chunk, cnt));
+		}
+	} else if constexpr (S == VEDA_OMP_SCHED_GUIDED) {
+		std::atomic<T> next(0);
+		#pragma omp parallel
+		{
+			T min = next.load();
+			while(min < cnt) {
+				T size	= std::max(chunk, veda_omp_align_up(T((cnt - min) / (2 * nthreads)), align));
+				T max	= std::min(min + size, cnt);
+				// on failure min gets updated to the current value of next
+				if(next.compare_exchange_weak(min, max)) {
+					func(min, max);
+					min = next.load();
+				}
+			}
+		}
+	} else if constexpr (S == VEDA_OMP_SCHED_STEAL) {
+		std::vector<veda_omp_steal_range<T>> ranges(nthreads);
+		T step = veda_omp_align_up(T((cnt + nthreads - 1) / nthreads), align);
+		for(T i = 0; i < nthreads; i++) {
+			ranges[i].next	= std::min(i * step, cnt);
+			ranges[i].end	= std::min((i + 1) * step, cnt);
+		}
+
+		#pragma omp parallel
+		{
+			/** Starts with the own range and then visits all other ranges, so
+			 * this also completes if the team has less than nthreads threads */
+			T tx = omp_get_thread_num();
+			for(T i = 0; i < nthreads; i++) {
+				auto& range = ranges[(tx + i) % nthreads];
+				for(T min = range.next.fetch_add(chunk); min < range.end; min = range.next.fetch_add(chunk))
+					func(min, std::min(min + chunk, range.end));
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp(const T cnt, F func, const T chunk = 0) {
 	if(__builtin_expect((cnt <= 0),0))
 		return;
 
@@ -89,6 +196,8 @@ inline void veda_omp(const T cnt, F func) {
 
 	if(cnt == 1 || nthreads == 1) {
 		func(T(0), cnt);
+	} else if constexpr (S != VEDA_OMP_SCHED_STATIC) {
+		veda_omp_dynamic<S>(cnt, func, T(1), chunk);
 	} else {
 		veda_omp_schedule<T> schedule(cnt);
 		#pragma omp parallel
@@ -102,8 +211,8 @@ inline void veda_omp(const T cnt, F func) {
 }
 
 //------------------------------------------------------------------------------
-template<typename T, typename F>
-inline void veda_omp_simd(const T cnt, F func, const T vl = 256) {
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp_simd(const T cnt, F func, const T vl = 256, const T chunk = 0) {
 	if(__builtin_expect((cnt <= 0),0))
 		return;
 
@@ -111,13 +220,17 @@ inline void veda_omp_simd(const T cnt, F func, const T vl = 256) {
 	T nthreads = omp_get_max_threads();
 
 	if(nthreads > 1 && cnt > vl) {
-		veda_omp_simd_schedule<T> schedule(cnt, vl);
-		#pragma omp parallel
-		{
-			T min, max;
-			std::tie(min, max) = schedule();
-			if(min < max)
-				func(min, max);
+		if constexpr (S != VEDA_OMP_SCHED_STATIC) {
+			veda_omp_dynamic<S>(cnt, func, vl, chunk);
+		} else {
+			veda_omp_simd_schedule<T> schedule(cnt, vl);
+			#pragma omp parallel
+			{
+				T min, max;
+				std::tie(min, max) = schedule();
+				if(min < max)
+					func(min, max);
+			}
 		}
 	} else {
 		func(T(0), cnt);
@@ -126,39 +239,55 @@ inline void veda_omp_simd(const T cnt, F func, const T vl = 256) {
 
 //------------------------------------------------------------------------------
 template<typename T, typename F, typename M, typename R>
-inline M veda_omp_simd_reduce(const T cnt, F func, R reduction, M min, const T vl = 256) {
+inline M veda_omp_simd_reduce(const T cnt, F func, R reduction, M init, const T vl = 256) {
 	if(__builtin_expect((cnt <= 0),0))
-		return;
+		return init;
 
 	veda_omp_check<T, F>();
 	T nthreads = omp_get_max_threads();
 
 	if(nthreads > 1 && cnt > vl) {
 		veda_omp_simd_schedule<T> schedule(cnt, vl);
+		std::vector<veda_omp_partial<M>> partials(nthreads);
 
-		M result = min;
 		#pragma omp parallel
 		{
+			T tx	= omp_get_thread_num();
+			T team	= omp_get_num_threads();
 			T min, max;
 			std::tie(min, max) = schedule();
-			if(min < max) {
-				auto local = func(min, max);
-				#pragma omp critical
-				result = reduction(result, local);
+
+			auto& partial	= partials[tx];
+			partial.valid	= min < max;
+			if(partial.valid)
+				partial.value = func(min, max);
+
+			/** Pairwise tree combination, after log2(team) steps partials[0]
+			 * holds the result of all threads. */
+			for(T stride = 1; stride < team; stride *= 2) {
+				#pragma omp barrier
+				if((tx % (2 * stride)) == 0 && (tx + stride) < team) {
+					auto& other = partials[tx + stride];
+					if(other.valid) {
+						partial.value = partial.valid ? reduction(partial.value, other.value) : other.value;
+						partial.valid = true;
+					}
+				}
 			}
 		}
-		return result;
+
+		return partials[0].valid ? reduction(init, partials[0].value) : init;
 	}
 
-	return func(T(0), cnt);
+	return reduction(init, func(T(0), cnt));
 }
 
 #else
 //------------------------------------------------------------------------------
 // Without OMP
 //------------------------------------------------------------------------------
-template<typename T, typename F>
-inline void veda_omp(const T cnt, F func) {
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp(const T cnt, F func, const T chunk = 0) {
 	if(__builtin_expect((cnt <= 0),0))
 		return;
 
@@ -167,8 +296,8 @@ inline void veda_omp(const T cnt, F func) {
 }
 
 //------------------------------------------------------------------------------
-template<typename T, typename F>
-inline void veda_omp_simd(const T cnt, const T vl, F func) {
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp_simd(const T cnt, F func, const T vl = 256, const T chunk = 0) {
 	if(__builtin_expect((cnt <= 0),0))
 		return;
 
@@ -178,14 +307,243 @@ inline void veda_omp_simd(const T cnt, const T vl, F func) {
 
 //------------------------------------------------------------------------------
 template<typename T, typename F, typename M, typename R>
-inline M veda_omp_simd_reduce(const T cnt, const T vl, F func, R reduction, M min) {
+inline M veda_omp_simd_reduce(const T cnt, F func, R reduction, M init, const T vl = 256) {
 	if(__builtin_expect((cnt <= 0),0))
-		return;
+		return init;
 		
 	veda_omp_check<T, F>();
-	return func(T(0), cnt);
+	return reduction(init, func(T(0), cnt));
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Persistent Team
+//------------------------------------------------------------------------------
+/** Runs func(arg, tx, nthreads) on all threads of the persistent worker team of
+ * libveda.vso, with the calling thread as tx == 0. Returns 0 without calling
+ * func if the team is already in use. */
+extern "C" int veda_team_run	(void (*func)(void*, int, int), void* arg);
+extern "C" int veda_team_size	(void);
+
+/** LLC size of the VE in bytes as reported by the host when it created the
+ * process, or 0 if unknown. */
+extern "C" size_t veda_omp_llc_bytes	(void);
+
+//------------------------------------------------------------------------------
+/** Like veda_omp, but runs on the persistent worker team, that spins between
+ * calls instead of opening a new OpenMP region. Intended for tiny workloads
+ * where the fork/join of an OpenMP region dominates. Falls back to a serial
+ * call if the team is busy, e.g., when called from within the team. */
+template<typename T, typename F>
+inline void veda_team(const T cnt, F func) {
+	if(__builtin_expect((cnt <= 0),0))
+		return;
+
+	veda_omp_check<T, F>();
+	T nthreads = veda_team_size();
+
+	if(cnt == 1 || nthreads == 1) {
+		func(T(0), cnt);
+		return;
+	}
+
+	auto work = [&](const int tx, const int n) {
+		T batch		= cnt / n;
+		T remain	= cnt % n;
+		T min		= batch * tx + (tx < remain ? tx : remain);
+		T max		= min + batch + (tx < remain ? 1 : 0);
+		if(min < max)
+			func(min, max);
+	};
+
+	if(!veda_team_run([](void* arg, int tx, int n) { (*(decltype(work)*)arg)(tx, n); }, &work))
+		func(T(0), cnt);
+}
+
+//------------------------------------------------------------------------------
+/** Like veda_omp_simd, but runs on the persistent worker team. */
+template<typename T, typename F>
+inline void veda_team_simd(const T cnt, F func, const T vl = 256) {
+	if(__builtin_expect((cnt <= 0),0))
+		return;
+
+	veda_omp_check<T, F>();
+	T nthreads = veda_team_size();
+
+	if(nthreads == 1 || cnt <= vl) {
+		func(T(0), cnt);
+		return;
+	}
+
+	auto work = [&](const int tx, const int n) {
+		T step	= veda_omp_align_up(T((cnt + n - 1) / n), vl);
+		T min	= std::min(T(tx) * step, cnt);
+		T max	= std::min(min + step, cnt);
+		if(min < max)
+			func(min, max);
+	};
+
+	if(!veda_team_run([](void* arg, int tx, int n) { (*(decltype(work)*)arg)(tx, n); }, &work))
+		func(T(0), cnt);
 }
+
+//------------------------------------------------------------------------------
+// Tiled Loops
+//------------------------------------------------------------------------------
+/** Returns the tile size of the inner dimension. If tile is 0, the inner
+ * dimension is not tiled up to 8 x VLEN elements. Tiles that don't span the
+ * entire dimension are rounded up to multiples of VLEN. */
+template<typename T>
+inline T veda_omp_tile_inner(const T cnt, T tile) {
+	if(tile <= 0)
+		tile = std::min(cnt, T(8 * VEDA_OMP_TILE_VLEN));
+	if(tile >= cnt)
+		return cnt;
+	return veda_omp_align_up(tile, T(VEDA_OMP_TILE_VLEN));
+}
+
+//------------------------------------------------------------------------------
+/** Default working set of a single tile: each thread's share of the LLC. */
+inline size_t veda_omp_tile_bytes(void) {
+	auto llc = veda_omp_llc_bytes();
+	if(llc == 0)
+		return VEDA_OMP_TILE_BYTES;
+#ifdef _OPENMP
+	return llc / std::max(omp_get_max_threads(), 1);
+#else
+	return llc;
 #endif
+}
+
+//------------------------------------------------------------------------------
+/** Returns the tile size of an outer dimension. If tile is 0, it gets chosen
+ * so that a tile covers about veda_omp_tile_bytes() of 8 byte elements. */
+template<typename T>
+inline T veda_omp_tile_outer(const T cnt, T tile, const T inner) {
+	if(tile <= 0)
+		tile = std::max(T(1), T(veda_omp_tile_bytes() / sizeof(uint64_t) / inner));
+	return std::min(tile, cnt);
+}
+
+//------------------------------------------------------------------------------
+/** Calls func(rowMin, rowMax, colMin, colMax) for all tiles of a rows x cols
+ * iteration space. Tiles are numbered row-major, so with the STATIC schedule
+ * each thread gets a contiguous band of tiles. Passing 0 as tile size selects
+ * a size based on veda_omp_tile_bytes(). */
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp_2d(const T rows, const T cols, const T tileR, const T tileC, F func) {
+	static_assert(std::is_convertible<F, std::function<void(const T, const T, const T, const T)>>::value);
+	if(__builtin_expect((rows <= 0 || cols <= 0),0))
+		return;
+
+	const T tc	= veda_omp_tile_inner(cols, tileC);
+	const T tr	= veda_omp_tile_outer(rows, tileR, tc);
+	const T nc	= (cols + tc - 1) / tc;
+	const T nr	= (rows + tr - 1) / tr;
+
+	veda_omp<S>(nr * nc, [&](const T min, const T max) {
+		for(T t = min; t < max; t++) {
+			const T r = (t / nc) * tr;
+			const T c = (t % nc) * tc;
+			func(r, std::min(r + tr, rows), c, std::min(c + tc, cols));
+		}
+	}, T(1));
+}
+
+//------------------------------------------------------------------------------
+/** 3D version of veda_omp_2d, calls func(min0, max0, min1, max1, min2, max2)
+ * with dimension 2 being the innermost one. */
+template<veda_omp_sched S = VEDA_OMP_SCHED_STATIC, typename T, typename F>
+inline void veda_omp_3d(const T cnt0, const T cnt1, const T cnt2, const T tile0, const T tile1, const T tile2, F func) {
+	static_assert(std::is_convertible<F, std::function<void(const T, const T, const T, const T, const T, const T)>>::value);
+	if(__builtin_expect((cnt0 <= 0 || cnt1 <= 0 || cnt2 <= 0),0))
+		return;
+
+	const T t2	= veda_omp_tile_inner(cnt2, tile2);
+	const T t1	= veda_omp_tile_outer(cnt1, tile1, t2);
+	const T t0	= veda_omp_tile_outer(cnt0, tile0, t1 * t2);
+	const T n2	= (cnt2 + t2 - 1) / t2;
+	const T n1	= (cnt1 + t1 - 1) / t1;
+	const T n0	= (cnt0 + t0 - 1) / t0;
+
+	veda_omp<S>(n0 * n1 * n2, [&](const T min, const T max) {
+		for(T t = min; t < max; t++) {
+			const T a = (t / (n1 * n2)) * t0;
+			const T b = ((t / n2) % n1) * t1;
+			const T c = (t % n2) * t2;
+			func(a, std::min(a + t0, cnt0), b, std::min(b + t1, cnt1), c, std::min(c + t2, cnt2));
+		}
+	}, T(1));
+}
+
+//------------------------------------------------------------------------------
+// Typed Reductions
+//------------------------------------------------------------------------------
+template<typename T>
+inline void veda_omp_reduce_check(void) {
+	static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value || std::is_same<T, int64_t>::value);
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline T veda_omp_simd_sum(const T* ptr, const size_t cnt) {
+	veda_omp_reduce_check<T>();
+	return veda_omp_simd_reduce(cnt, [=](const size_t min, const size_t max) {
+		T sum = 0;
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			sum += ptr[i];
+		return sum;
+	}, [](const T a, const T b) { return a + b; }, T(0), veda_omp_vlen<T>());
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline T veda_omp_simd_min(const T* ptr, const size_t cnt) {
+	veda_omp_reduce_check<T>();
+	return veda_omp_simd_reduce(cnt, [=](const size_t min, const size_t max) {
+		T value = std::numeric_limits<T>::max();
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			value = ptr[i] < value ? ptr[i] : value;
+		return value;
+	}, [](const T a, const T b) { return a < b ? a : b; }, std::numeric_limits<T>::max(), veda_omp_vlen<T>());
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+inline T veda_omp_simd_max(const T* ptr, const size_t cnt) {
+	veda_omp_reduce_check<T>();
+	return veda_omp_simd_reduce(cnt, [=](const size_t min, const size_t max) {
+		T value = std::numeric_limits<T>::lowest();
+		#pragma _NEC vector
+		for(size_t i = min; i < max; i++)
+			value = ptr[i] > value ? ptr[i] : value;
+		return value;
+	}, [](const T a, const T b) { return a > b ? a : b; }, std::numeric_limits<T>::lowest(), veda_omp_vlen<T>());
+}
+
+//------------------------------------------------------------------------------
+/** Returns the index of the first maximum, or 0 if cnt is 0. */
+template<typename T>
+inline size_t veda_omp_simd_argmax(const T* ptr, const size_t cnt) {
+	veda_omp_reduce_check<T>();
+	struct ArgMax { T value; size_t idx; };
+	auto result = veda_omp_simd_reduce(cnt, [=](const size_t min, const size_t max) {
+		ArgMax local = {ptr[min], min};
+		#pragma _NEC vector
+		for(size_t i = min + 1; i < max; i++) {
+			if(ptr[i] > local.value) {
+				local.value	= ptr[i];
+				local.idx	= i;
+			}
+		}
+		return local;
+	}, [](const ArgMax& a, const ArgMax& b) {
+		return (b.value > a.value || (b.value == a.value && b.idx < a.idx)) ? b : a;
+	}, ArgMax{std::numeric_limits<T>::lowest(), cnt}, veda_omp_vlen<T>());
+	return result.idx == cnt ? 0 : result.idx;
+}
 #else
 	#error "VEDA OMP API requires C++"
 #endif
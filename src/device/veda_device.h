@@ -1 +1,2 @@
 #include <veda/device.h>
+#include <veda/atomic.h>
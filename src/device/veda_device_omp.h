@@ -1 +1,2 @@
 #include <veda/omp.h>
+#include <veda/algorithm.h>
@@ -3,6 +3,12 @@
 #include <cstdlib>
 #include <cassert>
 #include <cstring>
+#include <csignal>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <getopt.h>
+#include <unistd.h>
 
 #define CHECK(err) check(err, __FILE__, __LINE__)
 
@@ -16,71 +22,499 @@ void check(VEDAresult err, const char* file, const int line) {
 	}
 }
 
-int main(int argc, char** argv) {
-	CHECK(vedaInit(0));
-	
+//------------------------------------------------------------------------------
+enum Format {
+	FORMAT_TEXT,
+	FORMAT_JSON,
+	FORMAT_CSV,
+	FORMAT_PROMETHEUS
+};
+
+enum Field {
+	FIELD_NAME,
+	FIELD_PHYSICAL,
+	FIELD_AVEO,
+	FIELD_CLOCK,
+	FIELD_CLOCK_BASE,
+	FIELD_CLOCK_MEMORY,
+	FIELD_MEMORY,
+	FIELD_POWER,
+	FIELD_CURRENT,
+	FIELD_VOLTAGE,
+	FIELD_CURRENT_EDGE,
+	FIELD_VOLTAGE_EDGE,
+	FIELD_TEMP,
+	FIELD_PROCESSES,
+	FIELD_MEMORY_USED,
+	FIELD_ALLOCATIONS,
+	FIELD_KERNELS_IN_FLIGHT,
+	FIELD_KERNELS_LAUNCHED,
+	FIELD_BUSY_TIME,
+	FIELD_CNT
+};
+
+static const char* s_fieldNames[FIELD_CNT] = {
+	"name",
+	"physical",
+	"aveo",
+	"clock",
+	"clock_base",
+	"clock_memory",
+	"memory",
+	"power",
+	"current",
+	"voltage",
+	"current_edge",
+	"voltage_edge",
+	"temp",
+	"processes",
+	"memory_used",
+	"allocations",
+	"kernels_in_flight",
+	"kernels_launched",
+	"busy_time"
+};
+
+/** Prometheus metric name, help and type of all numeric fields. */
+static const char* s_metrics[FIELD_CNT][3] = {
+	{0, 0, 0},
+	{0, 0, 0},
+	{0, 0, 0},
+	{"veda_clock_mhz",		"Current chip clock in MHz",					"gauge"},
+	{"veda_clock_base_mhz",		"Base clock in MHz",						"gauge"},
+	{"veda_clock_memory_mhz",	"Memory clock in MHz",						"gauge"},
+	{"veda_memory_total_bytes",	"Total device memory in bytes",					"gauge"},
+	{"veda_power_watts",		"Power consumption in W",					"gauge"},
+	{"veda_current_amperes",	"AUX current in A",						"gauge"},
+	{"veda_voltage_volts",		"AUX voltage in V",						"gauge"},
+	{"veda_current_edge_amperes",	"PCIe edge current in A",					"gauge"},
+	{"veda_voltage_edge_volts",	"PCIe edge voltage in V",					"gauge"},
+	{"veda_core_temperature_celsius","Core temperature in Celsius",					"gauge"},
+	{"veda_processes",		"Number of processes with an active context",			"gauge"},
+	{"veda_memory_used_bytes",	"Device memory allocated by all processes in bytes",		"gauge"},
+	{"veda_allocations",		"Number of allocations of all processes",			"gauge"},
+	{"veda_kernels_in_flight",	"Kernels enqueued but not yet synchronized by all processes",	"gauge"},
+	{"veda_kernels_launched_total",	"Kernels launched by all processes",				"counter"},
+	{"veda_busy_seconds_total",	"Cumulative run time of the kernels of all processes in s",	"counter"}
+};
+
+/** Static properties are queried once, only the telemetry and the processes
+ * get sampled. */
+struct Device {
+	VEDAdevice	id;
+	char		name[256];
+	int		physical, aveo, numa;
+	int		clockRate, clockBase, clockMemory, l1d, l1i, l2, llc, firmware;
+	size_t		memory;
+	VEDAtelemetry	telemetry;
+	std::vector<VEDAprocessUsage> processes;
+};
+
+static volatile sig_atomic_t s_running = 1;
+
+//------------------------------------------------------------------------------
+static void stop(int) {
+	s_running = 0;
+}
+
+//------------------------------------------------------------------------------
+static void usage(const char* name) {
+	printf("Usage: %s [options]\n", name);
+	printf("  -l, --loop <ms>         sample all devices every <ms> milliseconds\n");
+	printf("  -f, --format <format>   text (default), json, csv or prometheus\n");
+	printf("  -s, --fields <list>     comma separated list of fields for json, csv and prometheus:\n");
+	printf("                          ");
+	for(int f = 0; f < FIELD_CNT; f++)
+		printf("%s%s", s_fieldNames[f], f == FIELD_CNT - 1 ? "\n" : ",");
+	printf("  -o, --output <file>     atomically replace <file> with each sample instead of printing it\n");
+	printf("  -d, --daemon            detach from the terminal, requires --output, implies --loop 1000\n");
+	printf("  -h, --help              show this help\n");
+}
+
+//------------------------------------------------------------------------------
+static bool parseFields(const char* list, std::vector<bool>& fields) {
+	fields.assign(FIELD_CNT, false);
+	std::string str(list);
+	size_t pos = 0;
+	while(pos <= str.size()) {
+		auto end = str.find(',', pos);
+		if(end == std::string::npos)
+			end = str.size();
+		auto name = str.substr(pos, end - pos);
+		int f = 0;
+		for(; f < FIELD_CNT; f++)
+			if(name == s_fieldNames[f])
+				break;
+		if(f == FIELD_CNT) {
+			fprintf(stderr, "Unknown field: %s\n", name.c_str());
+			return false;
+		}
+		fields[f] = true;
+		pos = end + 1;
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+static uint64_t timestamp(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return uint64_t(ts.tv_sec) * 1000 + uint64_t(ts.tv_nsec) / 1000000;
+}
+
+//------------------------------------------------------------------------------
+/** Prints str as quoted string. CSV escapes quotes by doubling them, JSON and
+ * Prometheus labels use backslashes. */
+static void printString(FILE* out, const char* str, const bool csv) {
+	fputc('"', out);
+	for(const char* c = str; *c; c++) {
+		if(*c == '"')		fputc(csv ? '"' : '\\', out);
+		else if(*c == '\\' && !csv)	fputc('\\', out);
+		fputc(*c, out);
+	}
+	fputc('"', out);
+}
+
+//------------------------------------------------------------------------------
+static void sampleProcesses(Device& d) {
+	while(true) {
+		int cnt = (int)d.processes.size();
+		CHECK(vedaDeviceGetProcesses(d.processes.data(), &cnt, d.id));
+		bool complete = cnt <= (int)d.processes.size();
+		d.processes.resize(cnt);
+		if(complete)
+			return;
+	}
+}
+
+//------------------------------------------------------------------------------
+template<typename T>
+static double sum(const Device& d, T VEDAprocessUsage::*member) {
+	double value = 0;
+	for(auto& p : d.processes)
+		value += (double)(p.*member);
+	return value;
+}
+
+//------------------------------------------------------------------------------
+static double value(const Device& d, const int field) {
+	switch(field) {
+		case FIELD_PROCESSES:		return (double)d.processes.size();
+		case FIELD_MEMORY_USED:		return sum(d, &VEDAprocessUsage::memUsed);
+		case FIELD_ALLOCATIONS:		return sum(d, &VEDAprocessUsage::allocations);
+		case FIELD_KERNELS_IN_FLIGHT:	return sum(d, &VEDAprocessUsage::kernelsInFlight);
+		case FIELD_KERNELS_LAUNCHED:	return sum(d, &VEDAprocessUsage::kernelsLaunched);
+		case FIELD_BUSY_TIME:		return sum(d, &VEDAprocessUsage::busyTime) / 1000000000.0;
+		case FIELD_CLOCK:		return d.clockRate;
+		case FIELD_CLOCK_BASE:		return d.clockBase;
+		case FIELD_CLOCK_MEMORY:	return d.clockMemory;
+		case FIELD_MEMORY:		return (double)d.memory;
+		case FIELD_POWER:		return d.telemetry.power;
+		case FIELD_CURRENT:		return d.telemetry.current;
+		case FIELD_VOLTAGE:		return d.telemetry.voltage;
+		case FIELD_CURRENT_EDGE:	return d.telemetry.currentEdge;
+		case FIELD_VOLTAGE_EDGE:	return d.telemetry.voltageEdge;
+	}
+	assert(false);
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+/** Prints integral values, e.g., bytes, without loosing precision. */
+static void printValue(FILE* out, const double value) {
+	if(value == (double)(uint64_t)value)	fprintf(out, "%llu", (unsigned long long)value);
+	else					fprintf(out, "%g", value);
+}
+
+//------------------------------------------------------------------------------
+static void printText(FILE* out, const std::vector<Device>& devices) {
 	const char* aveo = 0;
 	CHECK(vedaDriverGetVersion(&aveo));
-	printf("╔ veda-smi ═════════════════════════════════════════════════════════════════════╗\n");
-	printf("║ VEDA Version: %-10s AVEO Version: %-10s                             ║\n", VEDA_VERSION, aveo);
-	printf("╚═══════════════════════════════════════════════════════════════════════════════╝\n\n");
-	
+	fprintf(out, "╔ veda-smi ═════════════════════════════════════════════════════════════════════╗\n");
+	fprintf(out, "║ VEDA Version: %-10s AVEO Version: %-10s                             ║\n", VEDA_VERSION, aveo);
+	fprintf(out, "╚═══════════════════════════════════════════════════════════════════════════════╝\n\n");
+
+	for(auto& d : devices) {
+		fprintf(out, "┌── #%-2i %s ", d.id, d.name);
+		size_t len = strlen(d.name) + 8;
+		for(size_t i = 0; i < (79-len); i++)
+			fprintf(out, "─");
+		fprintf(out, "┐\n");
+		fprintf(out, "  ┌ Physical: %1i.%1i\n", d.physical, d.numa);
+		fprintf(out, "  ├ AVEO:     %1i.%1i\n", d.aveo, d.numa);
+		fprintf(out, "  ├ Clock:    current: %i MHz, base: %i MHz, memory: %i MHz\n", d.clockRate, d.clockBase, d.clockMemory);
+		fprintf(out, "  ├ Firmware: %i\n", d.firmware);
+		fprintf(out, "  ├ Memory:   %llu MiB\n", d.memory/1024/1024);
+		fprintf(out, "  ├ Cache:    LLC: %ikB, L2: %ikB, L1d: %ikB, L1i: %ikB\n", d.llc, d.l2, d.l1d, d.l1i);
+		fprintf(out, "  ├ Temp:     ");
+		for(int i = 0; i < d.telemetry.cores; i++)
+			fprintf(out, "%2.1f°C ", d.telemetry.coreTemp[i]);
+		fprintf(out, "\n");
+
+		auto& t = d.telemetry;
+		fprintf(out, "  ├ Power:    %3.1fW (AUX: %3.1fV, %3.1fA Edge: %3.1fV, %3.1fA)\n", t.power, t.voltage, t.current, t.voltageEdge, t.currentEdge);
+		fprintf(out, "  └ Procs:    %i\n", (int)d.processes.size());
+		for(auto& p : d.processes)
+			fprintf(out, "      PID %-8i %llu MiB in %llu allocations, %i streams, %llu/%llu kernels in flight/launched, busy: %.1fs\n",
+				p.pid, (unsigned long long)(p.memUsed/1024/1024), (unsigned long long)p.allocations, p.streams,
+				(unsigned long long)p.kernelsInFlight, (unsigned long long)p.kernelsLaunched, p.busyTime / 1000000000.0);
+		fprintf(out, "└───────────────────────────────────────────────────────────────────────────────┘\n\n");
+	}
+}
+
+//------------------------------------------------------------------------------
+/** Prints one JSON object per sample and line. */
+static void printJSON(FILE* out, const std::vector<Device>& devices, const std::vector<bool>& fields) {
+	fprintf(out, "{\"timestamp\":%llu,\"devices\":[", (unsigned long long)timestamp());
+	for(size_t i = 0; i < devices.size(); i++) {
+		auto& d = devices[i];
+		fprintf(out, "%s{\"device\":%i", i ? "," : "", d.id);
+		for(int f = 0; f < FIELD_CNT; f++) {
+			if(!fields[f])
+				continue;
+			fprintf(out, ",\"%s\":", s_fieldNames[f]);
+			switch(f) {
+				case FIELD_NAME:	printString(out, d.name, false);		break;
+				case FIELD_PHYSICAL:	fprintf(out, "\"%i.%i\"", d.physical, d.numa);	break;
+				case FIELD_AVEO:	fprintf(out, "\"%i.%i\"", d.aveo, d.numa);	break;
+				case FIELD_TEMP:
+					fputc('[', out);
+					for(int c = 0; c < d.telemetry.cores; c++)
+						fprintf(out, "%s%.1f", c ? "," : "", d.telemetry.coreTemp[c]);
+					fputc(']', out);
+					break;
+				default:
+					printValue(out, value(d, f));
+			}
+		}
+		fputc('}', out);
+	}
+	fprintf(out, "]}\n");
+}
+
+//------------------------------------------------------------------------------
+/** Prints one row per device and sample. temp contains the core temperatures
+ * separated by spaces, as the number of cores differs between devices. */
+static void printCSV(FILE* out, const std::vector<Device>& devices, const std::vector<bool>& fields, const bool header) {
+	if(header) {
+		fprintf(out, "timestamp,device");
+		for(int f = 0; f < FIELD_CNT; f++)
+			if(fields[f])
+				fprintf(out, ",%s", s_fieldNames[f]);
+		fprintf(out, "\n");
+	}
+
+	auto ts = timestamp();
+	for(auto& d : devices) {
+		fprintf(out, "%llu,%i", (unsigned long long)ts, d.id);
+		for(int f = 0; f < FIELD_CNT; f++) {
+			if(!fields[f])
+				continue;
+			switch(f) {
+				case FIELD_NAME:	fputc(',', out); printString(out, d.name, true);	break;
+				case FIELD_PHYSICAL:	fprintf(out, ",%i.%i", d.physical, d.numa);	break;
+				case FIELD_AVEO:	fprintf(out, ",%i.%i", d.aveo, d.numa);		break;
+				case FIELD_TEMP:
+					fputc(',', out);
+					for(int c = 0; c < d.telemetry.cores; c++)
+						fprintf(out, "%s%.1f", c ? " " : "", d.telemetry.coreTemp[c]);
+					break;
+				default:
+					fputc(',', out);
+					printValue(out, value(d, f));
+			}
+		}
+		fprintf(out, "\n");
+	}
+}
+
+//------------------------------------------------------------------------------
+/** Prints the Prometheus text exposition format, e.g., for the textfile
+ * collector of the node exporter. name, physical and aveo become labels of
+ * veda_device_info. */
+static void printPrometheus(FILE* out, const std::vector<Device>& devices, const std::vector<bool>& fields) {
+	if(fields[FIELD_NAME] || fields[FIELD_PHYSICAL] || fields[FIELD_AVEO]) {
+		fprintf(out, "# HELP veda_device_info Static information of the device\n");
+		fprintf(out, "# TYPE veda_device_info gauge\n");
+		for(auto& d : devices) {
+			fprintf(out, "veda_device_info{device=\"%i\"", d.id);
+			if(fields[FIELD_NAME])		{ fprintf(out, ",name="); printString(out, d.name, false); }
+			if(fields[FIELD_PHYSICAL])	fprintf(out, ",physical=\"%i.%i\"", d.physical, d.numa);
+			if(fields[FIELD_AVEO])		fprintf(out, ",aveo=\"%i.%i\"", d.aveo, d.numa);
+			fprintf(out, "} 1\n");
+		}
+	}
+
+	for(int f = FIELD_CLOCK; f < FIELD_CNT; f++) {
+		if(!fields[f])
+			continue;
+		fprintf(out, "# HELP %s %s\n", s_metrics[f][0], s_metrics[f][1]);
+		fprintf(out, "# TYPE %s %s\n", s_metrics[f][0], s_metrics[f][2]);
+		for(auto& d : devices) {
+			if(f == FIELD_TEMP) {
+				for(int c = 0; c < d.telemetry.cores; c++)
+					fprintf(out, "%s{device=\"%i\",core=\"%i\"} %.1f\n", s_metrics[f][0], d.id, c, d.telemetry.coreTemp[c]);
+			} else {
+				fprintf(out, "%s{device=\"%i\"} ", s_metrics[f][0], d.id);
+				printValue(out, value(d, f));
+				fputc('\n', out);
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+static void print(FILE* out, const Format format, const std::vector<Device>& devices, const std::vector<bool>& fields, const bool first) {
+	switch(format) {
+		case FORMAT_TEXT:	printText	(out, devices);				break;
+		case FORMAT_JSON:	printJSON	(out, devices, fields);			break;
+		case FORMAT_CSV:	printCSV	(out, devices, fields, first);		break;
+		case FORMAT_PROMETHEUS:	printPrometheus	(out, devices, fields);			break;
+	}
+}
+
+//------------------------------------------------------------------------------
+/** Writes the sample to a temporary file and renames it, so readers never see
+ * a partially written file. */
+static void write(const char* output, const Format format, const std::vector<Device>& devices, const std::vector<bool>& fields) {
+	std::string tmp(output);
+	tmp.append(".tmp");
+
+	FILE* out = fopen(tmp.c_str(), "w");
+	if(!out) {
+		fprintf(stderr, "Unable to write %s\n", tmp.c_str());
+		exit(1);
+	}
+	print(out, format, devices, fields, true);
+	fclose(out);
+
+	if(rename(tmp.c_str(), output) != 0) {
+		fprintf(stderr, "Unable to rename %s to %s\n", tmp.c_str(), output);
+		exit(1);
+	}
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+	Format format		= FORMAT_TEXT;
+	int loop		= 0;
+	bool daemonize		= false;
+	const char* output	= 0;
+	std::vector<bool> fields(FIELD_CNT, true);
+
+	static struct option options[] = {
+		{"loop",	required_argument,	0, 'l'},
+		{"format",	required_argument,	0, 'f'},
+		{"fields",	required_argument,	0, 's'},
+		{"output",	required_argument,	0, 'o'},
+		{"daemon",	no_argument,		0, 'd'},
+		{"help",	no_argument,		0, 'h'},
+		{0, 0, 0, 0}
+	};
+
+	int opt;
+	while((opt = getopt_long(argc, argv, "l:f:s:o:dh", options, 0)) != -1) {
+		switch(opt) {
+			case 'l':
+				loop = std::atoi(optarg);
+				if(loop <= 0) {
+					fprintf(stderr, "--loop requires a positive number of milliseconds\n");
+					return 1;
+				}
+				break;
+			case 'f':
+				if	(strcmp(optarg, "text") == 0)		format = FORMAT_TEXT;
+				else if	(strcmp(optarg, "json") == 0)		format = FORMAT_JSON;
+				else if	(strcmp(optarg, "csv") == 0)		format = FORMAT_CSV;
+				else if	(strcmp(optarg, "prometheus") == 0)	format = FORMAT_PROMETHEUS;
+				else {
+					fprintf(stderr, "Unknown format: %s\n", optarg);
+					return 1;
+				}
+				break;
+			case 's':
+				if(!parseFields(optarg, fields))
+					return 1;
+				break;
+			case 'o':	output = optarg;	break;
+			case 'd':	daemonize = true;	break;
+			case 'h':	usage(argv[0]);		return 0;
+			default:	usage(argv[0]);		return 1;
+		}
+	}
+
+	if(daemonize) {
+		if(!output) {
+			fprintf(stderr, "--daemon requires --output\n");
+			return 1;
+		}
+		if(!loop)
+			loop = 1000;
+		// keep the working directory, so relative output paths stay valid
+		if(daemon(1, 0) != 0) {
+			perror("daemon");
+			return 1;
+		}
+	}
+
+	// vedaInit only discovers the devices, no VE process gets created as
+	// long as no context is used.
+	CHECK(vedaInit(0));
+
 	int cnt = 0;
 	CHECK(vedaDeviceGetCount(&cnt));
 
-	char name[256];
-
+	std::vector<Device> devices(cnt);
 	for(int dev = 0; dev < cnt; dev++) {
-		CHECK(vedaDeviceGetName(name, sizeof(name), dev));
-		size_t total = 0;
-		CHECK(vedaDeviceTotalMem(&total, dev));
-
-		int physical = 0, aveo = 0, numa = 0;
-		CHECK(vedaDeviceGetPhysicalId	(&physical, dev));
-		CHECK(vedaDeviceGetAVEOId	(&aveo, dev));
-		CHECK(vedaDeviceGetNUMAId	(&numa, dev));
-
-		int cores, clock_rate, clock_base, clock_memory, l1d, l1i, l2, llc, firmware;
-		CHECK(vedaDeviceGetAttribute(&cores, VEDA_DEVICE_ATTRIBUTE_MULTIPROCESSOR_COUNT, dev));
-		CHECK(vedaDeviceGetAttribute(&clock_rate,	VEDA_DEVICE_ATTRIBUTE_CLOCK_RATE, dev));
-		CHECK(vedaDeviceGetAttribute(&clock_base,	VEDA_DEVICE_ATTRIBUTE_CLOCK_BASE, dev));
-		CHECK(vedaDeviceGetAttribute(&clock_memory,	VEDA_DEVICE_ATTRIBUTE_MEMORY_CLOCK_RATE, dev));
-		CHECK(vedaDeviceGetAttribute(&l1d,		VEDA_DEVICE_ATTRIBUTE_L1D_CACHE_SIZE, dev));
-		CHECK(vedaDeviceGetAttribute(&l1i,		VEDA_DEVICE_ATTRIBUTE_L1I_CACHE_SIZE, dev));
-		CHECK(vedaDeviceGetAttribute(&l2,		VEDA_DEVICE_ATTRIBUTE_L2_CACHE_SIZE, dev));
-		CHECK(vedaDeviceGetAttribute(&llc,		VEDA_DEVICE_ATTRIBUTE_LLC_CACHE_SIZE, dev));
-		CHECK(vedaDeviceGetAttribute(&firmware,		VEDA_DEVICE_ATTRIBUTE_FIREWARE_VERSION, dev));
-
-		printf("┌── #%-2i %s ", dev, name);
-		size_t len = strlen(name) + 8;
-		for(size_t i = 0; i < (79-len); i++)
-			printf("─");
-		printf("┐\n");
-		printf("  ┌ Physical: %1i.%1i\n", physical, numa);
-		printf("  ├ AVEO:     %1i.%1i\n", aveo, numa);
-		printf("  ├ Clock:    current: %i MHz, base: %i MHz, memory: %i MHz\n", clock_rate, clock_base, clock_memory);
-		printf("  ├ Firmware: %i\n", firmware);
-		printf("  ├ Memory:   %llu MiB\n", total/1024/1024);
-		printf("  ├ Cache:    LLC: %ikB, L2: %ikB, L1d: %ikB, L1i: %ikB\n", llc, l2, l1d, l1i);
-		printf("  ├ Temp:     ");
-		
-		for(int i = 0; i < cores; i++) {
-			float temp = 0;
-			CHECK(vedaDeviceGetTemp(&temp, i, dev));
-			printf("%2.1f°C ", temp);
+		auto& d = devices[dev];
+		d.id = dev;
+		CHECK(vedaDeviceGetName		(d.name, sizeof(d.name), dev));
+		CHECK(vedaDeviceTotalMem	(&d.memory, dev));
+		CHECK(vedaDeviceGetPhysicalId	(&d.physical, dev));
+		CHECK(vedaDeviceGetAVEOId	(&d.aveo, dev));
+		CHECK(vedaDeviceGetNUMAId	(&d.numa, dev));
+		CHECK(vedaDeviceGetAttribute(&d.clockRate,	VEDA_DEVICE_ATTRIBUTE_CLOCK_RATE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.clockBase,	VEDA_DEVICE_ATTRIBUTE_CLOCK_BASE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.clockMemory,	VEDA_DEVICE_ATTRIBUTE_MEMORY_CLOCK_RATE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.l1d,		VEDA_DEVICE_ATTRIBUTE_L1D_CACHE_SIZE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.l1i,		VEDA_DEVICE_ATTRIBUTE_L1I_CACHE_SIZE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.l2,		VEDA_DEVICE_ATTRIBUTE_L2_CACHE_SIZE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.llc,		VEDA_DEVICE_ATTRIBUTE_LLC_CACHE_SIZE, dev));
+		CHECK(vedaDeviceGetAttribute(&d.firmware,	VEDA_DEVICE_ATTRIBUTE_FIREWARE_VERSION, dev));
+	}
+
+	signal(SIGINT,	stop);
+	signal(SIGTERM,	stop);
+
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+
+	for(bool first = true; s_running; first = false) {
+		for(auto& d : devices) {
+			CHECK(vedaDeviceGetTelemetry(&d.telemetry, d.id));
+			sampleProcesses(d);
 		}
-		printf("\n");
 
-		float power = 0, current = 0, voltage = 0, current_edge = 0, voltage_edge = 0;
-		CHECK(vedaDeviceGetPower(&power, dev));
-		CHECK(vedaDeviceGetCurrent(&current, dev));
-		CHECK(vedaDeviceGetVoltage(&voltage, dev));
-		CHECK(vedaDeviceGetCurrentEdge(&current_edge, dev));
-		CHECK(vedaDeviceGetVoltageEdge(&voltage_edge, dev));
-		printf("  └ Power:    %3.1fW (AUX: %3.1fV, %3.1fA Edge: %3.1fV, %3.1fA)\n", power, voltage, current, voltage_edge, current_edge);
-		printf("└───────────────────────────────────────────────────────────────────────────────┘\n\n");
+		if(output) {
+			write(output, format, devices, fields);
+		} else {
+			print(stdout, format, devices, fields, first);
+			fflush(stdout);
+		}
+
+		if(!loop)
+			break;
+
+		// sleep until an absolute deadline, so the sampling does not drift
+		next.tv_sec	+= loop / 1000;
+		next.tv_nsec	+= (loop % 1000) * 1000000l;
+		if(next.tv_nsec >= 1000000000l) {
+			next.tv_sec++;
+			next.tv_nsec -= 1000000000l;
+		}
+		while(s_running && clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, 0) != 0);
 	}
 
 	CHECK(vedaExit());
 	return 0;
-}
\ No newline at end of file
+}
@@ -19,20 +19,26 @@ extern "C" {
  * @retval VEDA_SUCCESS on Success \n 
  *
  * Initializes the driver API and must be called before any other function of
- * the VEDA driver API. Currently, the Flags parameter must be 0. If vedaInit()
+ * the VEDA driver API. Flags can be 0 or VEDA_INIT_PREWARM, which starts
+ * creating the context of device 0 in the background, so a subsequent
+ * vedaCtxCreate() does not need to wait for the VE process to start. The
+ * devices to prewarm can be selected with VEDA_PREWARM. If vedaInit()
  * has not been called, any function from the driver API will return 
  * VEDA_ERROR_NOT_INITIALIZED.
  */
 VEDAresult vedaInit(uint32_t Flags) {
 	L_TRACE("vedaInit(%u)", Flags);
 
-	// Flags needs to be 0
-	if(Flags != 0)
+	// Flags needs to be 0 or VEDA_INIT_PREWARM
+	if(Flags & ~uint32_t(VEDA_INIT_PREWARM))
 		return VEDA_ERROR_INVALID_VALUE;
 
 	TRY(
 		veda::setInitialized(true);
 		veda::Devices::init();
+		veda::Accounting::init();
+		veda::Trace::init();
+		veda::Devices::prewarm(Flags & VEDA_INIT_PREWARM);
 	)
 }
 
@@ -51,6 +57,8 @@ VEDAresult vedaExit(void) {
 		veda::setInitialized(false);
 		veda::Devices::shutdown();
 		veda::Contexts::shutdown();
+		veda::Accounting::shutdown();
+		veda::Trace::shutdown();
 	)
 }
 
@@ -104,7 +112,7 @@ VEDAresult vedaLaunchKernelEx(VEDAfunction f, VEDAstream stream, VEDAargs args,
 	GUARDED(
 		auto ctx = veda::Contexts::current();
 		L_TRACE("[ve:%i] vedaLaunchKernelEx(%p, %i, ..., %i, %p)", ctx->device().vedaId(), f, stream, destroyArgs, result);
-		ctx->call(f, stream, args, destroyArgs != 0, false, result);
+		ctx->launch(f, stream, args, destroyArgs != 0, result);
 	)
 }
 
@@ -0,0 +1,227 @@
+#include "veda/internal.h"
+#include <cerrno>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#define SHM_NAME_BUFFER_SIZE	32
+#define SHM_PREFIX		"veda."
+
+namespace veda {
+//------------------------------------------------------------------------------
+VEDAaccountingProcess* Accounting::s_process = 0;
+
+//------------------------------------------------------------------------------
+static inline uint64_t now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return uint64_t(ts.tv_sec) * 1000000000llu + uint64_t(ts.tv_nsec);
+}
+
+//------------------------------------------------------------------------------
+static inline void shmName(char* buffer, const size_t size, const int pid) {
+	snprintf(buffer, size, "/" SHM_PREFIX "%i", pid);
+}
+
+//------------------------------------------------------------------------------
+/** Publishes the statistics of all contexts of this process in the shared
+ * memory segment /dev/shm/veda.<pid>, so veda-smi can show which processes
+ * use a device. Can be disabled by setting VEDA_ACCOUNTING=0. Failing to create
+ * the segment only disables the accounting. */
+void Accounting::init(void) {
+	auto env = std::getenv("VEDA_ACCOUNTING");
+	if(env && !std::atoi(env))
+		return;
+
+	char name[SHM_NAME_BUFFER_SIZE];
+	shmName(name, sizeof(name), getpid());
+
+	int fd = shm_open(name, O_CREAT | O_RDWR | O_TRUNC | O_CLOEXEC, 0644);
+	if(fd < 0) {
+		L_WARN("Unable to create accounting segment %s", name);
+		return;
+	}
+
+	fchmod(fd, 0644); // not affected by the umask, so other users can read it
+	void* ptr = MAP_FAILED;
+	if(ftruncate(fd, sizeof(VEDAaccountingProcess)) == 0)
+		ptr = mmap(0, sizeof(VEDAaccountingProcess), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if(ptr == MAP_FAILED) {
+		L_WARN("Unable to map accounting segment %s", name);
+		shm_unlink(name);
+		return;
+	}
+
+	s_process	= (VEDAaccountingProcess*)ptr;
+	s_process->pid	= getpid();
+	__atomic_store_n(&s_process->magic, VEDA_ACCOUNTING_MAGIC, __ATOMIC_RELEASE);
+}
+
+//------------------------------------------------------------------------------
+void Accounting::shutdown(void) {
+	if(!s_process)
+		return;
+
+	char name[SHM_NAME_BUFFER_SIZE];
+	shmName(name, sizeof(name), s_process->pid);
+	munmap(s_process, sizeof(VEDAaccountingProcess));
+	shm_unlink(name);
+	s_process = 0;
+}
+
+//------------------------------------------------------------------------------
+VEDAaccountingDevice* Accounting::get(const Device& device) {
+	if(!s_process || device.vedaId() < 0 || device.vedaId() >= VEDA_ACCOUNTING_DEVICES)
+		return 0;
+
+	auto dev	= &s_process->devices[device.vedaId()];
+	dev->sensorId	= device.sensorId();
+	dev->numaId	= device.numaId();
+	return dev;
+}
+
+//------------------------------------------------------------------------------
+void Accounting::activate(VEDAaccountingDevice* dev, const int streams) {
+	if(!dev)
+		return;
+	__atomic_fetch_add(&dev->streams,	streams,	__ATOMIC_RELAXED);
+	__atomic_fetch_add(&dev->active,	1,		__ATOMIC_RELEASE);
+}
+
+//------------------------------------------------------------------------------
+/** Removes the streams of one context from dev. Multiple contexts of the same
+ * device share dev, so active counts the contexts and only drops to 0 when
+ * the last one gets destroyed. */
+void Accounting::release(VEDAaccountingDevice* dev, const int streams) {
+	if(!dev)
+		return;
+	__atomic_fetch_sub(&dev->streams,	streams,	__ATOMIC_RELAXED);
+	__atomic_fetch_sub(&dev->active,	1,		__ATOMIC_RELEASE);
+}
+
+//------------------------------------------------------------------------------
+void Accounting::memAlloc(VEDAaccountingDevice* dev, const size_t bytes) {
+	if(!dev)
+		return;
+	__atomic_fetch_add(&dev->memUsed,	bytes,	__ATOMIC_RELAXED);
+	__atomic_fetch_add(&dev->allocations,	1,	__ATOMIC_RELAXED);
+}
+
+//------------------------------------------------------------------------------
+void Accounting::memFree(VEDAaccountingDevice* dev, const size_t bytes) {
+	if(!dev)
+		return;
+	__atomic_fetch_sub(&dev->memUsed,	bytes,	__ATOMIC_RELAXED);
+	__atomic_fetch_sub(&dev->allocations,	1,	__ATOMIC_RELAXED);
+}
+
+//------------------------------------------------------------------------------
+/** Needs to be called with s.mutex locked. Only kernels launched by the
+ * application get counted. Returns the launch time that needs to be passed to
+ * completed, or 0 if dev is not set. */
+uint64_t Accounting::launch(VEDAaccountingDevice* dev, Stream& s) {
+	if(!dev)
+		return 0;
+	s.inFlight++;
+	__atomic_fetch_add(&dev->kernelsInFlight, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&dev->kernelsLaunched, 1, __ATOMIC_RELAXED);
+	return now();
+}
+
+//------------------------------------------------------------------------------
+/** Needs to be called with s.mutex locked, for every call of the stream in
+ * the order they complete. launched is 0 for calls that VEDA issued itself.
+ * Kernels that ran in a persistent stream provide the clock cycles measured
+ * on the device. For all others, AVEO does not report when they ran, so the
+ * time from the later of their launch and the completion of the previous
+ * call of the stream until their completion is used. */
+void Accounting::completed(VEDAaccountingDevice* dev, Stream& s, const uint64_t launched, const uint64_t cycles, const int clockRate) {
+	if(!dev)
+		return;
+
+	auto done = now();
+	if(launched) {
+		uint64_t busy = cycles && clockRate > 0 ? cycles * 1000 / uint64_t(clockRate) : done - std::max(launched, s.lastDone);
+		__atomic_fetch_add(&dev->busyTime, busy, __ATOMIC_RELAXED);
+	}
+	s.lastDone = done;
+}
+
+//------------------------------------------------------------------------------
+/** Needs to be called with s.mutex locked. */
+void Accounting::synced(VEDAaccountingDevice* dev, Stream& s) {
+	if(!dev || s.inFlight == 0)
+		return;
+	__atomic_fetch_sub(&dev->kernelsInFlight, s.inFlight, __ATOMIC_RELAXED);
+	s.inFlight = 0;
+}
+
+//------------------------------------------------------------------------------
+/** Collects the usage of all processes that have an active context on the
+ * physical device, including this one. Segments of processes that no longer
+ * exist are removed. Returns the number of processes, which can exceed max. */
+int Accounting::processes(VEDAprocessUsage* usage, const int max, const Device& device) {
+	auto dir = opendir("/dev/shm");
+	if(!dir)
+		return 0;
+
+	int cnt = 0;
+	while(auto entry = readdir(dir)) {
+		if(strncmp(entry->d_name, SHM_PREFIX, strlen(SHM_PREFIX)) != 0)
+			continue;
+
+		char* end = 0;
+		const int pid = (int)std::strtol(entry->d_name + strlen(SHM_PREFIX), &end, 10);
+		if(pid <= 0 || *end != 0)
+			continue;
+
+		char name[SHM_NAME_BUFFER_SIZE];
+		shmName(name, sizeof(name), pid);
+
+		if(kill(pid, 0) != 0 && errno == ESRCH) {
+			shm_unlink(name); // process crashed or did not call vedaExit
+			continue;
+		}
+
+		int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+		if(fd < 0)
+			continue;
+
+		struct stat sb;
+		void* ptr = MAP_FAILED;
+		if(fstat(fd, &sb) == 0 && size_t(sb.st_size) >= sizeof(VEDAaccountingProcess))
+			ptr = mmap(0, sizeof(VEDAaccountingProcess), PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+		if(ptr == MAP_FAILED)
+			continue;
+
+		auto proc = (const VEDAaccountingProcess*)ptr;
+		if(__atomic_load_n(&proc->magic, __ATOMIC_ACQUIRE) == VEDA_ACCOUNTING_MAGIC) {
+			for(auto& dev : proc->devices) {
+				if(!__atomic_load_n(&dev.active, __ATOMIC_ACQUIRE))		continue;
+				if(dev.sensorId != device.sensorId() || dev.numaId != device.numaId())	continue;
+
+				if(cnt < max) {
+					auto& u			= usage[cnt];
+					u.pid			= proc->pid;
+					u.streams		= __atomic_load_n(&dev.streams,		__ATOMIC_RELAXED);
+					u.memUsed		= __atomic_load_n(&dev.memUsed,		__ATOMIC_RELAXED);
+					u.allocations		= __atomic_load_n(&dev.allocations,	__ATOMIC_RELAXED);
+					u.kernelsInFlight	= __atomic_load_n(&dev.kernelsInFlight,	__ATOMIC_RELAXED);
+					u.kernelsLaunched	= __atomic_load_n(&dev.kernelsLaunched,	__ATOMIC_RELAXED);
+					u.busyTime		= __atomic_load_n(&dev.busyTime,	__ATOMIC_RELAXED);
+				}
+				cnt++;
+			}
+		}
+		munmap(ptr, sizeof(VEDAaccountingProcess));
+	}
+	closedir(dir);
+	return cnt;
+}
+
+//------------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+namespace veda {
+	class Accounting {
+		static VEDAaccountingProcess*	s_process;
+
+	public:
+		static	VEDAaccountingDevice*	get		(const Device& device);
+		static	int			processes	(VEDAprocessUsage* usage, const int max, const Device& device);
+		static	uint64_t		launch		(VEDAaccountingDevice* dev, Stream& s);
+		static	void			activate	(VEDAaccountingDevice* dev, const int streams);
+		static	void			completed	(VEDAaccountingDevice* dev, Stream& s, const uint64_t launched, const uint64_t cycles, const int clockRate);
+		static	void			init		(void);
+		static	void			memAlloc	(VEDAaccountingDevice* dev, const size_t bytes);
+		static	void			memFree		(VEDAaccountingDevice* dev, const size_t bytes);
+		static	void			release		(VEDAaccountingDevice* dev, const int streams);
+		static	void			shutdown	(void);
+		static	void			synced		(VEDAaccountingDevice* dev, Stream& s);
+	};
+}
\ No newline at end of file
@@ -30,26 +30,44 @@ static inline void vedaCtxCall(Context* ctx, VEDAstream stream, const bool check
 //------------------------------------------------------------------------------
 Device& 		Context::device		(void)		{	return m_device;		}
 VEDAcontext_mode	Context::mode		(void) const	{	return m_mode;			}
+VEDAcontext_mode	Context::prewarmMode	(void) const	{	return m_prewarmMode;		}
 bool			Context::isActive	(void) const	{	return m_handle != 0;		}
+bool			Context::isPrewarming	(void) const	{	return m_prewarm.valid();	}
+int			Context::ctxId		(void) const	{	return m_ctxId;			}
 int			Context::streamCount	(void) const	{	return (int)m_streams.size();	}
 
 //------------------------------------------------------------------------------
 void Context::setMemOverride(VEDAdeviceptr vptr) {
 	if(vptr != 0) {
 		if(VEDA_GET_OFFSET(vptr))			VEDA_THROW(VEDA_ERROR_OFFSET_NOT_ALLOWED);
-		if(VEDA_GET_DEVICE(vptr) != device().vedaId())	VEDA_THROW(VEDA_ERROR_INVALID_DEVICE);
+		checkPtr(vptr);
 	}
 	m_memOverride = vptr;
 }
 
 //------------------------------------------------------------------------------
-Context::Context(Device& device) :
+/** Throws if vptr belongs to another device or another context of this device. */
+void Context::checkPtr(VEDAdeviceptr vptr) const {
+	if(VEDA_GET_DEVICE(vptr) != m_device.vedaId())		VEDA_THROW(VEDA_ERROR_INVALID_DEVICE);
+	if(VEDA_GET_CTX(vptr) != m_ctxId)			VEDA_THROW(VEDA_ERROR_INVALID_CONTEXT);
+}
+
+//------------------------------------------------------------------------------
+VEDAdeviceptr Context::vptr(const VEDAidx idx) const {
+	return VEDA_SET_CTX_PTR(m_device.vedaId(), m_ctxId, idx, 0);
+}
+
+//------------------------------------------------------------------------------
+Context::Context(Device& device, const int ctxId) :
 	m_mode		(VEDA_CONTEXT_MODE_OMP),
+	m_prewarmMode	(VEDA_CONTEXT_MODE_OMP),
 	m_device	(device),
+	m_ctxId		(ctxId),
 	m_handle	(0),
 	m_lib		(0),
 	m_memidx	(1),
-	m_memOverride	(0)
+	m_memOverride	(0),
+	m_accounting	(0)
 {}
 
 //------------------------------------------------------------------------------
@@ -80,10 +98,9 @@ void Context::memReport(void) {
 	size_t used	= memUsed();
 
 	LOCK(mutex_ptrs);
-	printf("# VE#%i %.2f/%.2fGB\n", device().vedaId(), used/(1024.0*1024.0*1024.0), total/(1024.0*1024.0*1024.0));
+	printf("# VE#%i.%i %.2f/%.2fGB\n", device().vedaId(), ctxId(), used/(1024.0*1024.0*1024.0), total/(1024.0*1024.0*1024.0));
 	for(auto&& [idx, info] : m_ptrs) {
-		auto vptr = VEDA_SET_PTR(device().vedaId(), idx, 0);
-		printf("%p/%p %lluB\n", vptr, info->ptr, info->size);
+		printf("%p/%p %lluB\n", vptr(idx), info->ptr, info->size);
 	}
 	printf("\n");
 }
@@ -104,6 +121,7 @@ Stream& Context::stream(const VEDAstream stream) {
 const char* Context::kernelName(const Kernel k) const {
 	switch(k) {
 		case VEDA_KERNEL_MEMCPY_D2D:		return "veda_memcpy_d2d";
+		case VEDA_KERNEL_MEMOPS:		return "veda_memops";
 		case VEDA_KERNEL_MEMSET_U128:		return "veda_memset_u128";
 		case VEDA_KERNEL_MEMSET_U128_2D:	return "veda_memset_u128_2d";
 		case VEDA_KERNEL_MEMSET_U16:		return "veda_memset_u16";
@@ -114,11 +132,21 @@ const char* Context::kernelName(const Kernel k) const {
 		case VEDA_KERNEL_MEMSET_U64_2D:		return "veda_memset_u64_2d";
 		case VEDA_KERNEL_MEMSET_U8:		return "veda_memset_u8";
 		case VEDA_KERNEL_MEMSET_U8_2D:		return "veda_memset_u8_2d";
+		case VEDA_KERNEL_MEMSET_U8_3D:		return "veda_memset_u8_3d";
 		case VEDA_KERNEL_MEM_ALLOC:		return "veda_mem_alloc";
 		case VEDA_KERNEL_MEM_FREE:		return "veda_mem_free";
 		case VEDA_KERNEL_MEM_PTR:		return "veda_mem_ptr";
 		case VEDA_KERNEL_MEM_SIZE:		return "veda_mem_size";
 		case VEDA_KERNEL_MEM_SWAP:		return "veda_mem_swap";
+		case VEDA_KERNEL_CTX_GET_LIMIT:		return "veda_ctx_get_limit";
+		case VEDA_KERNEL_CTX_SET_LIMIT:		return "veda_ctx_set_limit";
+		case VEDA_KERNEL_CTX_TUNE_LIMITS:	return "veda_ctx_tune_limits";
+		case VEDA_KERNEL_SCAN:			return "veda_scan";
+		case VEDA_KERNEL_SORT:			return "veda_sort";
+		case VEDA_KERNEL_COMPACT:		return "veda_compact";
+		case VEDA_KERNEL_HISTOGRAM:		return "veda_histogram";
+		case VEDA_KERNEL_MEM_ALLOC_EX:		return "veda_mem_alloc_ex";
+		case VEDA_KERNEL_PERSISTENT:		return "veda_persistent";
 	}
 
 	VEDA_THROW(VEDA_ERROR_UNKNOWN_KERNEL);
@@ -133,6 +161,7 @@ const char* Context::kernelName(VEDAfunction func) const {
 
 	switch(idx) {
 		case VEDA_KERNEL_MEMCPY_D2D:	return "VEDA_KERNEL_MEMCPY_D2D";
+		case VEDA_KERNEL_MEMOPS:	return "VEDA_KERNEL_MEMOPS";
 		case VEDA_KERNEL_MEMSET_U16:	return "VEDA_KERNEL_MEMSET_U16";
 		case VEDA_KERNEL_MEMSET_U16_2D:	return "VEDA_KERNEL_MEMSET_U16_2D";
 		case VEDA_KERNEL_MEMSET_U32:	return "VEDA_KERNEL_MEMSET_U32";
@@ -141,11 +170,21 @@ const char* Context::kernelName(VEDAfunction func) const {
 		case VEDA_KERNEL_MEMSET_U64_2D:	return "VEDA_KERNEL_MEMSET_U64_2D";
 		case VEDA_KERNEL_MEMSET_U8:	return "VEDA_KERNEL_MEMSET_U8";
 		case VEDA_KERNEL_MEMSET_U8_2D:	return "VEDA_KERNEL_MEMSET_U8_2D";
+		case VEDA_KERNEL_MEMSET_U8_3D:	return "VEDA_KERNEL_MEMSET_U8_3D";
 		case VEDA_KERNEL_MEM_ALLOC:	return "VEDA_KERNEL_MEM_ALLOC";
 		case VEDA_KERNEL_MEM_FREE:	return "VEDA_KERNEL_MEM_FREE";
 		case VEDA_KERNEL_MEM_PTR:	return "VEDA_KERNEL_MEM_PTR";
 		case VEDA_KERNEL_MEM_SIZE:	return "VEDA_KERNEL_MEM_SIZE";
 		case VEDA_KERNEL_MEM_SWAP:	return "VEDA_KERNEL_MEM_SWAP";
+		case VEDA_KERNEL_CTX_GET_LIMIT:	return "VEDA_KERNEL_CTX_GET_LIMIT";
+		case VEDA_KERNEL_CTX_SET_LIMIT:	return "VEDA_KERNEL_CTX_SET_LIMIT";
+		case VEDA_KERNEL_CTX_TUNE_LIMITS:return "VEDA_KERNEL_CTX_TUNE_LIMITS";
+		case VEDA_KERNEL_SCAN:		return "VEDA_KERNEL_SCAN";
+		case VEDA_KERNEL_SORT:		return "VEDA_KERNEL_SORT";
+		case VEDA_KERNEL_COMPACT:	return "VEDA_KERNEL_COMPACT";
+		case VEDA_KERNEL_HISTOGRAM:return "VEDA_KERNEL_HISTOGRAM";
+		case VEDA_KERNEL_MEM_ALLOC_EX:	return "VEDA_KERNEL_MEM_ALLOC_EX";
+		case VEDA_KERNEL_PERSISTENT:	return "VEDA_KERNEL_PERSISTENT";
 	}
 
 	return "USER_KERNEL";
@@ -158,6 +197,41 @@ VEDAfunction Context::kernel(Kernel kernel) const {
 	return m_kernels[kernel];
 }
 
+//------------------------------------------------------------------------------
+// Limits
+//------------------------------------------------------------------------------
+size_t Context::getLimit(const VEDAlimit limit) {
+	if((uint32_t)limit >= VEDA_LIMIT_CNT)
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	uint64_t value = 0;
+	vedaCtxCall(this, 0, false, &value, kernel(VEDA_KERNEL_CTX_GET_LIMIT), limit);
+	sync(0);
+	return (size_t)value;
+}
+
+//------------------------------------------------------------------------------
+void Context::setLimit(const VEDAlimit limit, const size_t value) {
+	if((uint32_t)limit >= VEDA_LIMIT_CNT)
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	vedaCtxCall(this, 0, true, 0, kernel(VEDA_KERNEL_CTX_SET_LIMIT), limit, value);
+	sync(0);
+}
+
+//------------------------------------------------------------------------------
+/** Warns about limits for which the parallel version was not faster for any
+ * measured size, these keep the largest measured size. */
+void Context::tuneLimits(void) {
+	uint32_t untuned = 0;
+	vedaCtxCall(this, 0, true, 0, kernel(VEDA_KERNEL_CTX_TUNE_LIMITS), VEDAstack(&untuned, VEDA_ARGS_INTENT_OUT, sizeof(untuned)));
+	sync(0);
+
+	for(int i = 0; i < VEDA_LIMIT_CNT; i++)
+		if(untuned & (1u << i))
+			L_WARN("[ve:%i] vedaCtxTuneLimits: parallel version of limit %i did not win for any size, using %lluB", device().vedaId(), i, getLimit((VEDAlimit)i));
+}
+
 //------------------------------------------------------------------------------
 // Modules
 //------------------------------------------------------------------------------
@@ -197,6 +271,7 @@ void Context::incMemIdx(void) {
 //------------------------------------------------------------------------------
 void Context::syncPtrs(void) {
 	bool syn = false;
+	std::vector<VEDAdeviceptrInfo*> fetched;
 
 	// Don't lock mutex_ptrs here, as ALL calling functions do this on behalf of this
 	for(auto&& [idx, info] : m_ptrs) {
@@ -204,9 +279,9 @@ void Context::syncPtrs(void) {
 			// if size is == 0, then no malloc call had been issued, so we need to fetch the info
 			// is size is != 0, then we only need to wait till the malloc reports back the ptr
 			if(info->size == 0) {
-				auto vptr = VEDA_SET_PTR(device().vedaId(), idx, 0);
-				vedaCtxCall(this, 0, false, (uint64_t*)&info->ptr,  kernel(VEDA_KERNEL_MEM_PTR),  vptr);
-				vedaCtxCall(this, 0, false, (uint64_t*)&info->size, kernel(VEDA_KERNEL_MEM_SIZE), vptr);
+				vedaCtxCall(this, 0, false, (uint64_t*)&info->ptr,  kernel(VEDA_KERNEL_MEM_PTR),  vptr(idx));
+				vedaCtxCall(this, 0, false, (uint64_t*)&info->size, kernel(VEDA_KERNEL_MEM_SIZE), vptr(idx));
+				fetched.emplace_back(info);
 			}
 			syn = true;
 		}
@@ -215,10 +290,38 @@ void Context::syncPtrs(void) {
 	// sync all streams as we don't know which mallocs are in flight in a different stream
 	if(syn)
 		sync();
+
+	// allocations made on the device only become known to the accounting now
+	for(auto info : fetched)
+		if(info->size)
+			Accounting::memAlloc(m_accounting, info->size);
 }
 
 //------------------------------------------------------------------------------
-VEDAdeviceptr Context::memAlloc(const size_t size, VEDAstream stream) {
+VEDAdeviceptr Context::memAlloc(const size_t size, VEDAstream stream, VEDAmem_placement placement, int node) {
+	// Resolve Placement ---------------------------------------------------
+	switch(placement) {
+		case VEDA_MEM_PLACEMENT_DEFAULT:
+			break;
+		case VEDA_MEM_PLACEMENT_LOCAL:
+			// the VE process is bound to the NUMA node of the device
+			placement	= device().isNUMA() ? VEDA_MEM_PLACEMENT_NODE : VEDA_MEM_PLACEMENT_DEFAULT;
+			node		= device().numaId();
+			break;
+		case VEDA_MEM_PLACEMENT_INTERLEAVED:
+			if(!device().isNUMA())
+				placement = VEDA_MEM_PLACEMENT_DEFAULT;
+			break;
+		case VEDA_MEM_PLACEMENT_NODE:
+			if(node < 0 || node >= MAX_NUMA_NODES)
+				VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+			if(!device().isNUMA())
+				placement = VEDA_MEM_PLACEMENT_DEFAULT;
+			break;
+		default:
+			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+	}
+
 	if(m_memOverride)
 		syncPtrs();
 
@@ -230,7 +333,6 @@ VEDAdeviceptr Context::memAlloc(const size_t size, VEDAstream stream) {
 
 	// Override pointer? ---------------------------------------------------
 	if(m_memOverride) {
-		auto dev	= VEDA_GET_DEVICE(m_memOverride);	assert(dev == device().vedaId());
 		auto idx	= VEDA_GET_IDX(m_memOverride);
 		m_memOverride	= 0;
 		auto it		= m_ptrs.find(idx);
@@ -240,7 +342,7 @@ VEDAdeviceptr Context::memAlloc(const size_t size, VEDAstream stream) {
 		if(info->size != size)	VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
 		if(info->ptr  == 0)	VEDA_THROW(VEDA_ERROR_UNKNOWN_PPTR);
 
-		return VEDA_SET_PTR(dev, idx, 0);
+		return vptr(idx);
 	}
 
 	// Find free idx -------------------------------------------------------
@@ -249,16 +351,18 @@ VEDAdeviceptr Context::memAlloc(const size_t size, VEDAstream stream) {
 
 	auto idx  = m_memidx;
 	auto info = m_ptrs.emplace(MAP_EMPLACE(idx, new VEDAdeviceptrInfo(0, size))).first->second;
-	auto vptr = VEDA_SET_PTR(device().vedaId(), idx, 0);
+	auto ptr  = vptr(idx);
 
 	incMemIdx();
 
 	if(size) {
-		vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEM_ALLOC), vptr, size);
-		vedaCtxCall(this, stream, false, (uint64_t*)&info->ptr, kernel(VEDA_KERNEL_MEM_PTR), vptr);
+		Accounting::memAlloc(m_accounting, size);
+		if(placement == VEDA_MEM_PLACEMENT_DEFAULT)	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEM_ALLOC), ptr, size);
+		else						vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEM_ALLOC_EX), ptr, size, placement, int32_t(node));
+		vedaCtxCall(this, stream, false, (uint64_t*)&info->ptr, kernel(VEDA_KERNEL_MEM_PTR), ptr);
 	}
 
-	return vptr;
+	return ptr;
 }
 
 //------------------------------------------------------------------------------
@@ -282,7 +386,7 @@ void Context::memSwap(VEDAdeviceptr A, VEDAdeviceptr B, VEDAstream stream) {
 
 //------------------------------------------------------------------------------
 void Context::memFree(VEDAdeviceptr vptr, VEDAstream stream) {
-	ASSERT(VEDA_GET_DEVICE(vptr) == device().vedaId());
+	checkPtr(vptr);
 
 	// If this context is not active, we don't care about still pending frees.
 	if(!isActive())
@@ -304,8 +408,10 @@ void Context::memFree(VEDAdeviceptr vptr, VEDAstream stream) {
 	if(info->ptr == 0 && info->size != 0)
 		sync();
 
-	if(info->size)
+	if(info->size) {
 		vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEM_FREE), vptr);
+		Accounting::memFree(m_accounting, info->size);
+	}
 
 	delete info;
 	m_ptrs.erase(it);
@@ -313,7 +419,7 @@ void Context::memFree(VEDAdeviceptr vptr, VEDAstream stream) {
 
 //------------------------------------------------------------------------------
 VEDAdeviceptrInfo Context::getPtr(VEDAdeviceptr vptr) {
-	ASSERT(VEDA_GET_DEVICE(vptr) == device().vedaId());
+	checkPtr(vptr);
 	
 	LOCK(mutex_ptrs);
 	auto it = m_ptrs.find(VEDA_GET_IDX(vptr));
@@ -331,23 +437,239 @@ VEDAdeviceptrInfo Context::getPtr(VEDAdeviceptr vptr) {
 //------------------------------------------------------------------------------
 // Function Calls
 //------------------------------------------------------------------------------
-void Context::call(VEDAfunction func, VEDAstream _stream, VEDAargs args, const bool destroyArgs, const bool checkResult, uint64_t* result) {
-	auto& s		= stream(_stream);
-	uint64_t req	= CREQ(veo_call_async(s.ctx, func, args));
+void Context::call(VEDAfunction func, VEDAstream stream, VEDAargs args, const bool destroyArgs, const bool checkResult, uint64_t* result) {
+	call(func, stream, args, destroyArgs, checkResult, result, false);
+}
+
+//------------------------------------------------------------------------------
+/** Kernel launched by the application, other than the calls VEDA issues
+ * itself, these get counted in the accounting. */
+void Context::launch(VEDAfunction func, VEDAstream stream, VEDAargs args, const bool destroyArgs, uint64_t* result) {
+	call(func, stream, args, destroyArgs, false, result, true);
+}
+
+//------------------------------------------------------------------------------
+void Context::call(VEDAfunction func, VEDAstream _stream, VEDAargs args, const bool destroyArgs, const bool checkResult, uint64_t* result, const bool isLaunch) {
+	auto& s = stream(_stream);
+	{
+		LOCK(s.mutex);
+		auto packed = s.ring ? veda::packedArgs(args) : 0;
+		if(packed) {
+			ringCall(s, func, *packed, checkResult, result);
+		} else {
+			// AVEO executes the calls of a stream in order, so the loop needs to
+			// end before this call can run
+			ringStop(s);
+			s.calls.emplace_back(CREQ(veo_call_async(s.ctx, func, args)), checkResult, result, 0);
+		}
+		if(isLaunch)
+			std::get<3>(s.calls.back()) = Accounting::launch(m_accounting, s);
+		if(Trace::enabled())
+			traceSubmit(s, Trace::CALL, (uint64_t)func);
+	}
+
 	if(destroyArgs)
 		TVEDA(vedaArgsDestroy(args));
+}
 
+//------------------------------------------------------------------------------
+void Context::call(VEDAhost_function func, VEDAstream _stream, void* userData, const bool checkResult, uint64_t* result) {
+	auto& s = stream(_stream);
 	LOCK(s.mutex);
-	s.calls.emplace_back(req, checkResult, result);
+	ringStop(s);
+	uint64_t req = CREQ(veo_call_async_vh(s.ctx, func, userData));
+	s.calls.emplace_back(req, checkResult, result, 0);
+	if(Trace::enabled())
+		traceSubmit(s, Trace::HOST_CALL, (uint64_t)func);
 }
 
 //------------------------------------------------------------------------------
-void Context::call(VEDAhost_function func, VEDAstream _stream, void* userData, const bool checkResult, uint64_t* result) {
-	auto& s		= stream(_stream);
-	uint64_t req	= CREQ(veo_call_async_vh(s.ctx, func, userData));
+/** Records the call that has been added last to s.calls, see Trace. */
+void Context::traceSubmit(const Stream& s, const Trace::Type type, const uint64_t value) const {
+	Trace::submit(type, m_device.vedaId(), m_ctxId, int(&s - m_streams.data()), std::get<0>(s.calls.back()), value);
+}
 
-	LOCK(s.mutex);
-	s.calls.emplace_back(req, checkResult, result);
+//------------------------------------------------------------------------------
+// Channels
+//------------------------------------------------------------------------------
+VEDAdeviceptr Context::channelCreate(const size_t recordSize, const size_t capacity) {
+	if(recordSize == 0 || capacity == 0)
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	// rounding up capacity and computing the buffer size must not overflow
+	constexpr size_t maxCapacity = (SIZE_MAX >> 1) + 1;
+	if(capacity > maxCapacity || recordSize > SIZE_MAX - 2 * sizeof(uint64_t))
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	VEDAchannelHeader header = {};
+	header.capacity		= 1;
+	header.recordSize	= recordSize;
+	while(header.capacity < capacity)
+		header.capacity <<= 1;
+
+	const size_t slot = VEDA_CHANNEL_SLOT(recordSize);
+	if(header.capacity > (SIZE_MAX - sizeof(VEDAchannelHeader)) / slot)
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	// zeroed sequence numbers mark all slots as empty
+	const size_t bytes	= sizeof(VEDAchannelHeader) + header.capacity * slot;
+	auto vptr		= memAlloc(bytes, 0);
+	memset(vptr, uint64_t(0), bytes / sizeof(uint64_t), 0);
+	memcpyH2D(vptr, &header, sizeof(header), 0);
+	sync(0);
+	return vptr;
+}
+
+//------------------------------------------------------------------------------
+size_t Context::channelPoll(VEDAdeviceptr vptr, void* records, const size_t maxRecords) {
+	if(!vptr || (!records && maxRecords))
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+	if(VEDA_GET_OFFSET(vptr))
+		VEDA_THROW(VEDA_ERROR_OFFSET_NOT_ALLOWED);
+
+	auto info = getPtr(vptr);
+	if(info.ptr == 0 || info.size < sizeof(VEDAchannelHeader))
+		VEDA_THROW(VEDA_ERROR_UNKNOWN_PPTR);
+
+	// the host owned cache line contains tail, capacity and recordSize
+	auto hmem	= (char*)((veo_ptr)info.ptr | hmemId());
+	auto pTail	= hmem + offsetof(VEDAchannelHeader, tail);
+	uint64_t state[3];
+	TVEO(veo_hmemcpy(state, pTail, sizeof(state)));
+	const uint64_t tail	= state[0];
+	const uint64_t capacity	= state[1];
+	const uint64_t rsize	= state[2];
+	const size_t slot	= VEDA_CHANNEL_SLOT(rsize);
+	const size_t max	= std::min(maxRecords, size_t(capacity));
+
+	// Reads n slots starting at pos, which must not wrap around.
+	std::vector<char> buffer(max * slot);
+	auto read = [&](const uint64_t pos, const size_t n) {
+		auto src = hmem + sizeof(VEDAchannelHeader) + (pos & (capacity - 1)) * slot;
+		TVEO(veo_hmemcpy(buffer.data() + (pos - tail) * slot, src, n * slot));
+	};
+
+	// peek at the first slot, so polling an empty channel needs a single read
+	size_t cnt = 0;
+	if(max) {
+		read(tail, 1);
+		if(*(uint64_t*)buffer.data() == tail + 1) {
+			size_t first	= std::min(max, size_t(capacity - (tail & (capacity - 1))));
+			if(first > 1)	read(tail + 1, first - 1);
+			if(max > first)	read(tail + first, max - first);
+
+			for(; cnt < max; cnt++) {
+				auto s = buffer.data() + cnt * slot;
+				if(*(uint64_t*)s != tail + cnt + 1)
+					break;
+				memcpy((char*)records + cnt * rsize, s + sizeof(uint64_t), rsize);
+			}
+		}
+	}
+
+	// free the consumed slots for the device
+	if(cnt) {
+		uint64_t next = tail + cnt;
+		TVEO(veo_hmemcpy(pTail, &next, sizeof(next)));
+	}
+	return cnt;
+}
+
+//------------------------------------------------------------------------------
+// Persistent Streams
+//------------------------------------------------------------------------------
+void Context::streamSetPersistent(VEDAstream _stream, const bool enable) {
+	auto& s = stream(_stream);
+	if(enable == (s.ring != 0))
+		return;
+
+	if(enable) {
+		const size_t bytes	= VEDA_PERSISTENT_CAPACITY * sizeof(VEDAcommand);
+		auto ring		= memAlloc(bytes, _stream);
+		memset(ring, uint64_t(0), bytes / sizeof(uint64_t), _stream);
+		auto info		= getPtr(ring);
+
+		LOCK(s.mutex);
+		s.ring		= ring;
+		s.ringPtr	= (veo_ptr)info.ptr;
+		s.ringHmem	= (char*)(s.ringPtr | hmemId());
+		s.ringPos	= 0;
+		s.ringSynced	= 0;
+	} else {
+		VEDAdeviceptr ring = 0;
+		{
+			LOCK(s.mutex);
+			ringStop(s);
+			sync(s);
+			ring		= s.ring;
+			s.ring		= 0;
+			s.ringPtr	= 0;
+			s.ringHmem	= 0;
+		}
+		memFree(ring, _stream);
+	}
+}
+
+//------------------------------------------------------------------------------
+void Context::ringWrite(Stream& s, VEDAfunction func, const uint64_t* args) {
+	uint64_t body[1 + VEDA_PERSISTENT_ARGS] = {(uint64_t)func};
+	if(args)
+		memcpy(body + 1, args, sizeof(uint64_t) * VEDA_PERSISTENT_ARGS);
+
+	// seq gets written last, as it releases the command to the device
+	auto slot	= s.ringHmem + (s.ringPos & (VEDA_PERSISTENT_CAPACITY - 1)) * sizeof(VEDAcommand);
+	uint64_t seq	= s.ringPos + 1;
+	TVEO(veo_hmemcpy(slot + offsetof(VEDAcommand, func), body, sizeof(body)));
+	TVEO(veo_hmemcpy(slot + offsetof(VEDAcommand, seq), &seq, sizeof(seq)));
+	s.ringPos++;
+}
+
+//------------------------------------------------------------------------------
+void Context::ringCall(Stream& s, VEDAfunction func, const PackedArgs& packed, const bool checkResult, uint64_t* result) {
+	// the slot gets reused, so the results of the last round need to be collected
+	if((s.ringPos - s.ringSynced) >= VEDA_PERSISTENT_CAPACITY)
+		sync(s);
+
+	// start the loop, uses AVEO directly to not replace the packed arguments
+	if(s.ringLoop == VEO_REQUEST_ID_INVALID) {
+		auto args = veo_args_alloc();
+		if(!args)
+			VEDA_THROW(VEDA_ERROR_OUT_OF_MEMORY);
+		veo_args_set_u64(args, 0, s.ringPtr);
+		veo_args_set_u64(args, 1, s.ringPos);
+		veo_args_set_i32(args, 2, Trace::enabled() || m_accounting != 0);
+		s.ringLoop = veo_call_async(s.ctx, kernel(VEDA_KERNEL_PERSISTENT), args);
+		veo_args_free(args);
+		if(s.ringLoop == VEO_REQUEST_ID_INVALID)
+			VEDA_THROW(VEDA_ERROR_INVALID_REQID);
+	}
+
+	s.calls.emplace_back(VEDA_PERSISTENT_REQ | s.ringPos, checkResult, result, 0);
+	ringWrite(s, func, packed.regs);
+}
+
+//------------------------------------------------------------------------------
+void Context::ringStop(Stream& s) {
+	if(s.ringLoop == VEO_REQUEST_ID_INVALID)
+		return;
+
+	s.calls.emplace_back(VEDA_PERSISTENT_REQ | s.ringPos, false, (uint64_t*)0, 0);
+	ringWrite(s, 0, 0);
+	s.calls.emplace_back(s.ringLoop, true, (uint64_t*)0, 0);
+	s.ringLoop = VEO_REQUEST_ID_INVALID;
+}
+
+//------------------------------------------------------------------------------
+/** Waits for the command at pos and returns its result. The device counters
+ * get read in the same veo_hmemcpy and stored in counters. */
+uint64_t Context::ringWait(Stream& s, const uint64_t pos, uint64_t* counters) {
+	auto slot = s.ringHmem + (pos & (VEDA_PERSISTENT_CAPACITY - 1)) * sizeof(VEDAcommand);
+	uint64_t state[2 + VEDA_PERSISTENT_COUNTERS]; // done, result, counters
+	do {
+		TVEO(veo_hmemcpy(state, slot + offsetof(VEDAcommand, done), sizeof(state)));
+	} while(state[0] != pos + 1);
+	memcpy(counters, state + 2, sizeof(uint64_t) * VEDA_PERSISTENT_COUNTERS);
+	return state[1];
 }
 
 //------------------------------------------------------------------------------
@@ -371,11 +693,13 @@ void Context::memcpyD2H(void* dst, VEDAdeviceptr src, const size_t bytes, VEDAst
 	if((bytes + VEDA_GET_OFFSET(src)) > size)
 		VEDA_THROW(VEDA_ERROR_OUT_OF_BOUNDS);
 
-	auto& s		= stream(_stream);
-	uint64_t req	= CREQ(veo_async_read_mem(s.ctx, dst, (veo_ptr)ptr, bytes));
-
+	auto& s = stream(_stream);
 	LOCK(s.mutex);
-	s.calls.emplace_back(req, false, (uint64_t*)0);
+	ringStop(s);
+	uint64_t req = CREQ(veo_async_read_mem(s.ctx, dst, (veo_ptr)ptr, bytes));
+	s.calls.emplace_back(req, false, (uint64_t*)0, 0);
+	if(Trace::enabled())
+		traceSubmit(s, Trace::MEMCPY_D2H, bytes);
 }
 
 //------------------------------------------------------------------------------
@@ -389,11 +713,81 @@ void Context::memcpyH2D(VEDAdeviceptr dst, const void* src, const size_t bytes,
 	if((bytes + VEDA_GET_OFFSET(dst)) > size)
 		VEDA_THROW(VEDA_ERROR_OUT_OF_BOUNDS);
 
-	auto& s		= stream(_stream);
-	uint64_t req	= CREQ(veo_async_write_mem(s.ctx, (veo_ptr)ptr, src, bytes));
-
+	auto& s = stream(_stream);
 	LOCK(s.mutex);
-	s.calls.emplace_back(req, false, (uint64_t*)0);
+	ringStop(s);
+	uint64_t req = CREQ(veo_async_write_mem(s.ctx, (veo_ptr)ptr, src, bytes));
+	s.calls.emplace_back(req, false, (uint64_t*)0, 0);
+	if(Trace::enabled())
+		traceSubmit(s, Trace::MEMCPY_H2D, bytes);
+}
+
+//------------------------------------------------------------------------------
+// MemOps
+//------------------------------------------------------------------------------
+void Context::memOps(const VEDAmemop* ops, const int n, VEDAstream stream) {
+	if(!ops || n <= 0)
+		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+
+	for(int i = 0; i < n; i++) {
+		auto& op = ops[i];
+		if(!op.dst)				VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+		checkPtr(op.dst);
+		if(op.type == VEDA_MEMOP_MEMCPY) {
+			if(!op.src)			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+			checkPtr(op.src);
+		}
+	}
+
+	// ops are copied by AVEO when the call gets issued, so the caller can release them immediately
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEMOPS), VEDAstack((void*)ops, VEDA_ARGS_INTENT_IN, sizeof(VEDAmemop) * n), int32_t(n));
+}
+
+//------------------------------------------------------------------------------
+// Algorithms
+//------------------------------------------------------------------------------
+void Context::checkAlgorithmPtr(VEDAdeviceptr vptr) const {
+	if(!vptr)						VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+	checkPtr(vptr);
+}
+
+//------------------------------------------------------------------------------
+void Context::scan(VEDAdeviceptr dst, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype, const bool inclusive, VEDAstream stream) {
+	if(dtype < VEDA_DTYPE_INT32 || dtype > VEDA_DTYPE_DOUBLE)
+		VEDA_THROW(VEDA_ERROR_INVALID_DTYPE);
+	checkAlgorithmPtr(dst);
+	checkAlgorithmPtr(src);
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_SCAN), dst, src, cnt, dtype, int32_t(inclusive));
+}
+
+//------------------------------------------------------------------------------
+void Context::sort(VEDAdeviceptr keys, VEDAdeviceptr values, const size_t cnt, const VEDAdtype dtype, VEDAstream stream) {
+	if(dtype < VEDA_DTYPE_INT32 || dtype > VEDA_DTYPE_DOUBLE)
+		VEDA_THROW(VEDA_ERROR_INVALID_DTYPE);
+	checkAlgorithmPtr(keys);
+	if(values)
+		checkAlgorithmPtr(values);
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_SORT), keys, values, cnt, dtype);
+}
+
+//------------------------------------------------------------------------------
+void Context::compact(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, const size_t cnt, const VEDAdtype dtype, VEDAdeviceptr pcnt, VEDAstream stream) {
+	if(dtype < VEDA_DTYPE_INT32 || dtype > VEDA_DTYPE_DOUBLE)
+		VEDA_THROW(VEDA_ERROR_INVALID_DTYPE);
+	checkAlgorithmPtr(dst);
+	checkAlgorithmPtr(src);
+	checkAlgorithmPtr(mask);
+	checkAlgorithmPtr(pcnt);
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_COMPACT), dst, src, mask, cnt, dtype, pcnt);
+}
+
+//------------------------------------------------------------------------------
+void Context::histogram(VEDAdeviceptr bins, const size_t nbins, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype, VEDAstream stream) {
+	if(dtype < VEDA_DTYPE_INT32 || dtype > VEDA_DTYPE_UINT64)
+		VEDA_THROW(VEDA_ERROR_INVALID_DTYPE);
+	checkAlgorithmPtr(bins);
+	checkAlgorithmPtr(src);
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_HISTOGRAM), bins, nbins, src, cnt, dtype);
 }
 
 //------------------------------------------------------------------------------
@@ -448,6 +842,11 @@ void Context::memset2D(VEDAdeviceptr dst, const size_t pitch, const uint64_t x,
 	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEMSET_U128_2D), dst, pitch, x, y, w, h);
 }
 
+//------------------------------------------------------------------------------
+void Context::memset3D(VEDAdeviceptr dst, const size_t pitch, const size_t slicePitch, const uint8_t value, const size_t w, const size_t h, const size_t d, VEDAstream stream) {
+	vedaCtxCall(this, stream, true, 0, kernel(VEDA_KERNEL_MEMSET_U8_3D), dst, pitch, slicePitch, value, w, h, d);
+}
+
 //------------------------------------------------------------------------------
 void Context::sync(void) {
 	for(size_t i = 0; i < m_streams.size(); i++)
@@ -458,11 +857,26 @@ void Context::sync(void) {
 //------------------------------------------------------------------------------
 void Context::sync(VEDAstream _stream) {
 	auto& s = stream(_stream);
-
 	LOCK(s.mutex);
-	for(auto&& [id, checkResult, result] : s.calls) {
-		uint64_t res = 0;
-		TVEO(veo_call_wait_result(s.ctx, id, &res));
+	sync(s);
+}
+
+//------------------------------------------------------------------------------
+void Context::sync(Stream& s) {
+	// Don't lock s.mutex here, as ALL calling functions do this on behalf of this
+	for(auto&& [id, checkResult, result, launched] : s.calls) {
+		uint64_t res	= 0;
+		uint64_t begin	= Trace::enabled() ? Trace::now() : 0;
+		uint64_t counters[VEDA_PERSISTENT_COUNTERS] = {};
+		if(id & VEDA_PERSISTENT_REQ)	res = ringWait(s, id & ~VEDA_PERSISTENT_REQ, counters);
+		else				TVEO(veo_call_wait_result(s.ctx, id, &res));
+
+		// only calls of persistent streams report device cycles
+		const int clockRate = counters[0] ? m_device.clockRate() : 0;
+		if(begin && Trace::enabled())
+			Trace::wait(m_device.vedaId(), m_ctxId, int(&s - m_streams.data()), id, begin, counters, clockRate);
+		if(m_accounting)
+			Accounting::completed(m_accounting, s, launched, counters[0], clockRate);
 
 		if(result)
 			*result = res;
@@ -475,11 +889,25 @@ void Context::sync(VEDAstream _stream) {
 	}
 	
 	s.calls.clear();
+	s.ringSynced = s.ringPos;
+	Accounting::synced(m_accounting, s);
 }
 
 //------------------------------------------------------------------------------
 VEDAresult Context::query(VEDAstream _stream) {
-	auto state = veo_get_context_state(stream(_stream).ctx);
+	auto& s = stream(_stream);
+	{
+		// the persistent loop keeps the AVEO context running, so check the
+		// last command instead
+		LOCK(s.mutex);
+		if(s.ringLoop != VEO_REQUEST_ID_INVALID) {
+			uint64_t done = 0;
+			TVEO(veo_hmemcpy(&done, s.ringHmem + ((s.ringPos - 1) & (VEDA_PERSISTENT_CAPACITY - 1)) * sizeof(VEDAcommand) + offsetof(VEDAcommand, done), sizeof(done)));
+			return done == s.ringPos ? VEDA_SUCCESS : VEDA_ERROR_VEO_STATE_RUNNING;
+		}
+	}
+
+	auto state = veo_get_context_state(s.ctx);
 	switch(state) {
 		case VEO_STATE_UNKNOWN:	return VEDA_ERROR_VEO_STATE_UNKNOWN;
 		case VEO_STATE_RUNNING:	return VEDA_ERROR_VEO_STATE_RUNNING;
@@ -492,6 +920,78 @@ VEDAresult Context::query(VEDAstream _stream) {
 
 //------------------------------------------------------------------------------
 void Context::init(const VEDAcontext_mode mode) {
+	if(prewarmed(mode))
+		return;
+	create(mode);
+}
+
+//------------------------------------------------------------------------------
+/** Starts creating the context in the background, so the VE process already
+ * runs when the application calls vedaCtxCreate. */
+void Context::prewarm(const VEDAcontext_mode mode) {
+	if(isActive() || m_prewarm.valid())
+		return;
+	m_prewarmMode	= mode;
+	m_prewarm	= std::async(std::launch::async, [this, mode] { create(mode); });
+}
+
+//------------------------------------------------------------------------------
+/** Waits for a running prewarm. If it failed, the partially created context
+ * gets destroyed, so the next init starts from scratch. */
+void Context::prewarmWait(void) {
+	if(!m_prewarm.valid())
+		return;
+
+	try {
+		m_prewarm.get();
+	} catch(VEDAresult res) {
+		const char* name = 0;
+		vedaGetErrorName(res, &name);
+		L_WARN("[ve:%i] Prewarming context failed: %s", device().vedaId(), name);
+		if(isActive())
+			destroy();
+	}
+}
+
+//------------------------------------------------------------------------------
+/** Returns true if a prewarmed context with the requested mode is available.
+ * A prewarmed context with a different mode gets destroyed. */
+bool Context::prewarmed(const VEDAcontext_mode mode) {
+	if(!m_prewarm.valid())
+		return false;
+
+	prewarmWait();
+	if(isActive() && m_mode != mode)
+		destroy();
+	return isActive();
+}
+
+//------------------------------------------------------------------------------
+/** Reads the addresses of all VEDA kernels from veda_kernel_table in a single
+ * veo_read_mem. Returns false if the table is missing or does not match this
+ * library, e.g., with an outdated libveda.vso. */
+bool Context::loadKernelTable(void) {
+	auto sym = veo_get_sym(m_handle, m_lib->lib(), "veda_kernel_table");
+	if(sym == 0)
+		return false;
+
+	uint64_t table[1 + VEDA_KERNEL_CNT];
+	if(veo_read_mem(m_handle, table, sym, sizeof(table)) != 0)
+		return false;
+	if(table[0] != VEDA_KERNEL_CNT)
+		return false;
+
+	for(int i = 0; i < VEDA_KERNEL_CNT; i++)
+		if(table[1 + i] == 0)
+			return false;
+
+	for(int i = 0; i < VEDA_KERNEL_CNT; i++)
+		m_kernels[i] = table[1 + i];
+	return true;
+}
+
+//------------------------------------------------------------------------------
+void Context::create(const VEDAcontext_mode mode) {
 	if(isActive())
 		VEDA_THROW(VEDA_ERROR_CANNOT_CREATE_CONTEXT);
 
@@ -505,31 +1005,58 @@ void Context::init(const VEDAcontext_mode mode) {
 		cores = std::min(cores, omp);
 
 	// Calculate the number of VEDA SM based on the VEDA context mode.
-	if(mode == VEDA_CONTEXT_MODE_OMP) {
-		char buffer[3];
-		snprintf(buffer, sizeof(buffer), "%i", cores);
-		setenv("VE_OMP_NUM_THREADS", buffer, 1);
-		numStreams = 1;
-	} else if(mode == VEDA_CONTEXT_MODE_SCALAR) {
-		setenv("VE_OMP_NUM_THREADS", "1", 1);
-		numStreams = cores;
-	} else {
-		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
-	}
+	if(mode == VEDA_CONTEXT_MODE_OMP)		numStreams = 1;
+	else if(mode == VEDA_CONTEXT_MODE_SCALAR)	numStreams = cores;
+	else						VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
 	ASSERT(numStreams);
 
-	// VE process is created and started on the VE device.
-	m_handle = veo_proc_create(this->device().aveoId());
-	if(!m_handle)
-		VEDA_THROW(VEDA_ERROR_CANNOT_CREATE_CONTEXT);
+	{
+		// The environment is read by veo_proc_create, so contexts that get
+		// created concurrently, e.g., while prewarming, must not interleave.
+		static std::mutex s_mutex;
+		LOCK(s_mutex);
+
+		char buffer[32];
+		snprintf(buffer, sizeof(buffer), "%i", mode == VEDA_CONTEXT_MODE_OMP ? cores : 1);
+		setenv("VE_OMP_NUM_THREADS", buffer, 1);
+
+		// Bind the VE process and its OpenMP threads to the cores of the NUMA
+		// node, as cores() only counts these. A VE_NUMA_OPT set by the user
+		// takes precedence. Ours gets removed right after creating the
+		// process, so it does not leak into other contexts.
+		bool numaOpt = device().isNUMA() && !std::getenv("VE_NUMA_OPT");
+		if(numaOpt) {
+			snprintf(buffer, sizeof(buffer), "--cpunodebind=%i", device().numaId());
+			setenv("VE_NUMA_OPT", buffer, 1);
+		}
+
+		// The device library sizes its default OpenMP tiles and the default
+		// of VEDA_LIMIT_NONTEMPORAL by the LLC, which it cannot query itself.
+		// Passing it here saves a round trip after creating the process.
+		bool llcBytes = device().cacheLLC() > 0 && !std::getenv("VE_VEDA_LLC_BYTES");
+		if(llcBytes) {
+			snprintf(buffer, sizeof(buffer), "%zu", size_t(device().cacheLLC()) * 1024);
+			setenv("VE_VEDA_LLC_BYTES", buffer, 1);
+		}
+
+		// VE process is created and started on the VE device.
+		m_handle = veo_proc_create(this->device().aveoId());
+		if(numaOpt)
+			unsetenv("VE_NUMA_OPT");
+		if(llcBytes)
+			unsetenv("VE_VEDA_LLC_BYTES");
+		if(!m_handle)
+			VEDA_THROW(VEDA_ERROR_CANNOT_CREATE_CONTEXT);
+	}
 
 	// Load STDLib ---------------------------------------------------------
 	m_kernels.resize(VEDA_KERNEL_CNT);
 
 	// Load the VEDA kernel module on the VE device memory.
 	m_lib = moduleLoad(veda::stdLib());
-	for(int i = 0; i < VEDA_KERNEL_CNT; i++)
-		m_kernels[i] = moduleGetFunction(m_lib, kernelName((Kernel)i));
+	if(!loadKernelTable())
+		for(int i = 0; i < VEDA_KERNEL_CNT; i++)
+			m_kernels[i] = moduleGetFunction(m_lib, kernelName((Kernel)i));
 
 	// Create Streams ------------------------------------------------------
 	m_streams.resize(numStreams);
@@ -543,6 +1070,13 @@ void Context::init(const VEDAcontext_mode mode) {
 		stream.calls.reserve(128);
 		ASSERT(stream.calls.empty());
 	}
+
+	m_accounting = Accounting::get(device());
+	Accounting::activate(m_accounting, numStreams);
+
+	// Limits --------------------------------------------------------------
+	if(mode == VEDA_CONTEXT_MODE_OMP && veda::isTuneLimits())
+		tuneLimits();
 }
 
 //------------------------------------------------------------------------------
@@ -550,13 +1084,18 @@ void Context::destroy(void) {
 	if(!isActive())
 		VEDA_THROW(VEDA_ERROR_CONTEXT_IS_DESTROYED);
 
+	// a running persistent loop would keep its AVEO context busy forever,
+	// so stop it and free the ring before tearing down the process
+	for(size_t i = 0; i < m_streams.size(); i++)
+		if(m_streams[i].ring)
+			streamSetPersistent((VEDAstream)i, false);
+
 	LOCK(mutex_ptrs);
 	syncPtrs();
 
 	if(veda::isMemTrace()) {
 		for(auto&& [idx, info] : m_ptrs) {
-			auto vptr = (VEDAdeviceptr)(VEDA_SET_PTR(device().vedaId(), idx, 0));
-			printf("[VEDA ERROR]: VEDAdeviceptr %p with size %lluB has not been freed!\n", vptr, info->size);
+			printf("[VEDA ERROR]: VEDAdeviceptr %p with size %lluB has not been freed!\n", vptr(idx), info->size);
 		}
 	}
 	
@@ -565,6 +1104,16 @@ void Context::destroy(void) {
 		m_handle = 0;
 	}
 
+	// Other contexts of this device share the accounting slot, so only
+	// remove what belongs to this context
+	for(auto& stream : m_streams)
+		Accounting::synced(m_accounting, stream);
+	for(auto&& [idx, info] : m_ptrs)
+		if(info->size)
+			Accounting::memFree(m_accounting, info->size);
+	Accounting::release(m_accounting, streamCount());
+	m_accounting = 0;
+
 	m_streams.clear();	// don't need to be destroyed
 	m_modules.clear();	// don't need to be destroyed
 	m_kernels.clear();	// don't need to be destroyed
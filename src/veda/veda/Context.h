@@ -16,47 +16,79 @@ namespace veda {
 			std::mutex		mutex_modules;
 
 			VEDAcontext_mode	m_mode;
+			VEDAcontext_mode	m_prewarmMode;
 			Modules			m_modules;
 			Ptrs			m_ptrs;
 			Kernels			m_kernels;
 			Streams			m_streams;
 			Device&			m_device;
+		const	int			m_ctxId;
 			veo_proc_handle*	m_handle;
 			VEDAmodule		m_lib;
 			VEDAidx			m_memidx;
 			VEDAdeviceptr		m_memOverride;
+			VEDAaccountingDevice*	m_accounting;
+			std::future<void>	m_prewarm;
 
+		bool			loadKernelTable		(void);
+		void			call			(VEDAfunction func, VEDAstream stream, VEDAargs args, const bool destroyArgs, const bool checkResult, uint64_t* result, const bool isLaunch);
+		void			create			(const VEDAcontext_mode mode);
 		void			incMemIdx		(void);
 		void			syncPtrs		(void);
+		void			checkAlgorithmPtr	(VEDAdeviceptr vptr) const;
+		void			checkPtr		(VEDAdeviceptr vptr) const;
+		VEDAdeviceptr		vptr			(const VEDAidx idx) const;
+		uint64_t		ringWait		(Stream& s, const uint64_t pos, uint64_t* counters);
+		void			ringCall		(Stream& s, VEDAfunction func, const PackedArgs& packed, const bool checkResult, uint64_t* result);
+		void			ringStop		(Stream& s);
+		void			ringWrite		(Stream& s, VEDAfunction func, const uint64_t* args);
+		void			sync			(Stream& s);
+		void			traceSubmit		(const Stream& s, const Trace::Type type, const uint64_t value) const;
 
 	public:
-					Context			(Device& device);
+					Context			(Device& device, const int ctxId);
 					Context			(const Context&) = delete;
 		Device&			device			(void);
 		Module*			moduleLoad		(const char* name);
 		Stream&			stream			(const VEDAstream stream);
 		VEDAcontext_mode	mode			(void) const;
-		VEDAdeviceptr		memAlloc		(const size_t size, VEDAstream stream);
+		VEDAcontext_mode	prewarmMode		(void) const;
+		VEDAdeviceptr		channelCreate		(const size_t recordSize, const size_t capacity);
+		VEDAdeviceptr		memAlloc		(const size_t size, VEDAstream stream, const VEDAmem_placement placement = VEDA_MEM_PLACEMENT_DEFAULT, const int node = 0);
 		VEDAdeviceptrInfo	getPtr			(VEDAdeviceptr vptr);
 		VEDAfunction		kernel			(Kernel kernel) const;
 		VEDAfunction		moduleGetFunction	(Module* mod, const char* name);
 		VEDAresult		query			(VEDAstream stream);
 		VPtrTuple		memAllocPitch		(const size_t w_bytes, const size_t h, const uint32_t elementSize, VEDAstream stream);
 		bool			isActive		(void) const;
+		bool			isPrewarming		(void) const;
+		bool			prewarmed		(const VEDAcontext_mode mode);
+		int			ctxId			(void) const;
 		int			streamCount		(void) const;
+		size_t			getLimit		(const VEDAlimit limit);
+		size_t			channelPoll		(VEDAdeviceptr channel, void* records, const size_t maxRecords);
 		size_t			memUsed			(void);
 		veo_ptr			hmemId			(void) const;
 		void			call			(VEDAfunction func, VEDAstream stream, VEDAargs args, const bool destroyArgs, const bool checkResult, uint64_t* result);
 		void			call			(VEDAhost_function func, VEDAstream stream, void* userData, const bool checkResult, uint64_t* result);
+		void			compact			(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, const size_t cnt, const VEDAdtype dtype, VEDAdeviceptr pcnt, VEDAstream stream);
 		void			destroy			(void);
+		void			histogram		(VEDAdeviceptr bins, const size_t nbins, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype, VEDAstream stream);
 		void			init			(const VEDAcontext_mode mode);
+		void			launch			(VEDAfunction func, VEDAstream stream, VEDAargs args, const bool destroyArgs, uint64_t* result);
+		void			prewarm			(const VEDAcontext_mode mode);
+		void			prewarmWait		(void);
 		void			memFree			(VEDAdeviceptr vptr, VEDAstream stream);
+		void			scan			(VEDAdeviceptr dst, VEDAdeviceptr src, const size_t cnt, const VEDAdtype dtype, const bool inclusive, VEDAstream stream);
+		void			setLimit		(const VEDAlimit limit, const size_t value);
 		void			setMemOverride		(VEDAdeviceptr vptr);
+		void			streamSetPersistent	(VEDAstream stream, const bool enable);
 		void			memReport		(void);
 		void			memSwap			(VEDAdeviceptr A, VEDAdeviceptr B, VEDAstream stream);
 		void			memcpyD2D		(VEDAdeviceptr dst, VEDAdeviceptr src, const size_t size, VEDAstream stream);
 		void			memcpyD2H		(void* dst, VEDAdeviceptr src, const size_t size, VEDAstream stream);
 		void			memcpyH2D		(VEDAdeviceptr dst, const void* src, const size_t size, VEDAstream stream);
+		void			memOps			(const VEDAmemop* ops, const int n, VEDAstream stream);
 		void			memset			(VEDAdeviceptr dst, const uint16_t value, const size_t size, VEDAstream stream);
 		void			memset			(VEDAdeviceptr dst, const uint32_t value, const size_t size, VEDAstream stream);
 		void			memset			(VEDAdeviceptr dst, const uint64_t value, const size_t size, VEDAstream stream);
@@ -67,9 +99,12 @@ namespace veda {
 		void			memset2D		(VEDAdeviceptr dst, const size_t pitch, const uint64_t value, const size_t w, const size_t h, VEDAstream stream);
 		void			memset2D		(VEDAdeviceptr dst, const size_t pitch, const uint64_t x, const uint64_t y, const size_t w, const size_t h, VEDAstream stream);
 		void			memset2D		(VEDAdeviceptr dst, const size_t pitch, const uint8_t value, const size_t w, const size_t h, VEDAstream stream);
+		void			memset3D		(VEDAdeviceptr dst, const size_t pitch, const size_t slicePitch, const uint8_t value, const size_t w, const size_t h, const size_t d, VEDAstream stream);
 		void			moduleUnload		(const Module* mod);
+		void			sort			(VEDAdeviceptr keys, VEDAdeviceptr values, const size_t cnt, const VEDAdtype dtype, VEDAstream stream);
 		void			sync			(VEDAstream stream);
 		void			sync			(void);
+		void			tuneLimits		(void);
 	const	char*			kernelName		(VEDAfunction func) const;
 	const	char*			kernelName		(const Kernel k) const;
 	};
@@ -3,11 +3,28 @@
 namespace veda {
 //------------------------------------------------------------------------------
 class Stacks;
-struct Stack : public std::list<VEDAcontext> {
-	Stacks*	m_stacks;
-	
-	Stack	(void);
-	~Stack	(void);
+
+/** Context stack of a thread. The first STACK_INLINE entries are stored inline,
+ * so pushing and popping does not allocate for typical nesting depths. The top
+ * of the stack is cached in m_current, so Contexts::current() does not need to
+ * index into the stack. */
+struct Stack {
+	static constexpr int STACK_INLINE = 8;
+
+	VEDAcontext			m_current;
+	int				m_size;
+	VEDAcontext			m_inline[STACK_INLINE];
+	std::vector<VEDAcontext>	m_spill;
+	Stacks*				m_stacks;
+
+			Stack	(void);
+			~Stack	(void);
+	inline	VEDAcontext&	at	(const int idx)		{	return idx < STACK_INLINE ? m_inline[idx] : m_spill[idx - STACK_INLINE];	}
+	inline	bool		empty	(void) const		{	return m_size == 0;								}
+		void		clear	(void);
+		void		pop	(void);
+		void		push	(VEDAcontext ctx);
+		void		remove	(VEDAcontext ctx);
 };
 
 //------------------------------------------------------------------------------
@@ -58,7 +75,7 @@ static Stacks s_stacks;
 //------------------------------------------------------------------------------
 // Stack
 //------------------------------------------------------------------------------
-inline Stack::Stack(void) : m_stacks(0) {
+inline Stack::Stack(void) : m_current(0), m_size(0), m_stacks(0) {
 	s_stacks.add(this);
 }
 
@@ -68,6 +85,39 @@ inline Stack::~Stack(void) {
 		m_stacks->remove(this);
 }
 
+//------------------------------------------------------------------------------
+void Stack::clear(void) {
+	m_spill.clear();
+	m_size		= 0;
+	m_current	= 0;
+}
+
+//------------------------------------------------------------------------------
+void Stack::push(VEDAcontext ctx) {
+	if(m_size < STACK_INLINE)	m_inline[m_size] = ctx;
+	else				m_spill.emplace_back(ctx);
+	m_size++;
+	m_current = ctx;
+}
+
+//------------------------------------------------------------------------------
+void Stack::pop(void) {
+	assert(m_size > 0);
+	if(--m_size >= STACK_INLINE)
+		m_spill.pop_back();
+	m_current = m_size ? at(m_size - 1) : 0;
+}
+
+//------------------------------------------------------------------------------
+void Stack::remove(VEDAcontext ctx) {
+	int size = 0;
+	for(int i = 0; i < m_size; i++)
+		if(at(i) != ctx)
+			at(size++) = at(i);
+	while(m_size > size)
+		pop();
+}
+
 //------------------------------------------------------------------------------
 thread_local Stack t_stack;
 
@@ -75,9 +125,9 @@ thread_local Stack t_stack;
 // Contexts
 //------------------------------------------------------------------------------
 VEDAcontext Contexts::current(void) {
-	if(t_stack.empty())
+	auto ctx = t_stack.m_current;
+	if(!ctx)
 		throw VEDA_ERROR_UNKNOWN_CONTEXT; // don't use VEDA_THROW to prevent polluting the log in case vedaCtxGetDevice is called
-	auto ctx = t_stack.back();
 	if(!ctx->isActive())
 		VEDA_THROW(VEDA_ERROR_CONTEXT_IS_DESTROYED);
 	return ctx;
@@ -86,13 +136,13 @@ VEDAcontext Contexts::current(void) {
 //------------------------------------------------------------------------------
 VEDAcontext Contexts::pop(void) {
 	auto ctx = current();
-	t_stack.pop_back();
+	t_stack.pop();
 	return ctx;
 }
 
 //------------------------------------------------------------------------------
 void Contexts::push(VEDAcontext ctx) {
-	t_stack.emplace_back(ctx);
+	t_stack.push(ctx);
 }
 //------------------------------------------------------------------------------
 void Contexts::remove(VEDAcontext ctx) {
@@ -101,21 +151,23 @@ void Contexts::remove(VEDAcontext ctx) {
 
 //------------------------------------------------------------------------------
 int Contexts::countInstances(VEDAcontext ctx) {
+	auto& stack = t_stack;
 	int count = 0;
-	for(auto it : t_stack)
-		if(it == ctx)
+	for(int i = 0; i < stack.m_size; i++)
+		if(stack.at(i) == ctx)
 			count++;
 	return count;
 }
 
 //------------------------------------------------------------------------------
 void Contexts::set(VEDAcontext ctx) {
+	auto& stack = t_stack;
 	if(ctx) {
-		if(t_stack.empty())	t_stack.emplace_back(ctx);
-		else 			t_stack.back() = ctx;
+		if(stack.empty())	stack.push(ctx);
+		else 			stack.m_current = stack.at(stack.m_size - 1) = ctx;
 	} else {
-		if(!t_stack.empty()) 
-			t_stack.pop_back();
+		if(!stack.empty()) 
+			stack.pop();
 	}
 }
 
@@ -4,30 +4,33 @@
 
 namespace veda {
 //------------------------------------------------------------------------------
-Context&	Device::ctx		(void) 						{	return m_ctx;								}
+Context&	Device::ctx		(void) 						{	return m_ctxs.front();							}
 VEDAdevice	Device::vedaId		(void) const					{	return m_vedaId;							}
-bool		Device::isNUMA		(void) const					{	return m_isNUMA;							}
-float		Device::powerCurrent	(void) const					{	return readSensor<float>("sensor_12")/1000.0f / (isNUMA() ? 2 : 1);	}
-float		Device::powerCurrentEdge(void) const					{	return readSensor<float>("sensor_13")/1000.0f / (isNUMA() ? 2 : 1);	}
-float		Device::powerVoltage	(void) const					{	return readSensor<float>("sensor_8")/1000000.0f;			}
-float		Device::powerVoltageEdge(void) const					{	return readSensor<float>("sensor_9")/1000000.0f;			}
+bool		Device::isNUMA		(void) const					{	return props().isNUMA;							}
+float		Device::powerCurrent	(void) const					{	return telemetry().current;						}
+float		Device::powerCurrentEdge(void) const					{	return telemetry().currentEdge;						}
+float		Device::powerVoltage	(void) const					{	return telemetry().voltage;						}
+float		Device::powerVoltageEdge(void) const					{	return telemetry().voltageEdge;						}
 int		Device::aveoId		(void) const					{	return m_aveoId;							}
-int		Device::cacheL1d	(void) const					{	return m_cacheL1d;							}
-int		Device::cacheL1i	(void) const					{	return m_cacheL1i;							}
-int		Device::cacheL2		(void) const					{	return m_cacheL2;							}
-int		Device::cacheLLC	(void) const					{	return m_cacheLLC;							}
-int		Device::clockBase	(void) const					{	return m_clockBase;							}
-int		Device::clockMemory	(void) const					{	return m_clockMemory;							}
-int		Device::clockRate	(void) const					{	return m_clockRate;							}
-int		Device::cores		(void) const					{	return (int)m_cores.size();						}
-int		Device::model		(void) const					{	return m_model;								}
+int		Device::cacheL1d	(void) const					{	return props().cacheL1d;						}
+int		Device::cacheL1i	(void) const					{	return props().cacheL1i;						}
+int		Device::cacheL2		(void) const					{	return props().cacheL2;							}
+int		Device::cacheLLC	(void) const					{	return props().cacheLLC;						}
+int		Device::clockBase	(void) const					{	return props().clockBase;						}
+int		Device::clockMemory	(void) const					{	return props().clockMemory;						}
+int		Device::clockRate	(void) const					{	return props().clockRate;						}
+int		Device::contexts	(void) const					{	return (int)m_ctxs.size();						}
+int		Device::cores		(void) const					{	return (int)props().cores.size();					}
+int		Device::model		(void) const					{	return props().model;							}
 int		Device::numaId		(void) const					{	return m_numaId;							}
+int		Device::physicalCore	(const int core) const				{	return props().cores[core];						}
 int		Device::sensorId	(void) const					{	return m_sensorId;							}
-int		Device::versionAbi	(void) const					{	return m_versionAbi;							}
-int		Device::versionFirmware	(void) const					{	return m_versionFirmware;						}
-size_t		Device::memorySize	(void) const					{	return m_memorySize;							}
-int		Device::type		(void) const					{	return m_type;								}
+int		Device::versionAbi	(void) const					{	return props().versionAbi;						}
+int		Device::versionFirmware	(void) const					{	return props().versionFirmware;						}
+size_t		Device::memorySize	(void) const					{	return props().memorySize;						}
+int		Device::type		(void) const					{	return props().type;							}
 uint64_t	Device::readSensor	(const char* file, const bool isHex) const	{	return Devices::readSensor(sensorId(), file, isHex);			}
+VEDAtelemetry	Device::telemetry	(void) const					{	return m_telemetry.get();						}
 
 //------------------------------------------------------------------------------
 Device::Device(const VEDAdevice vedaId, const int aveoId, const int sensorId, const int numaId) :
@@ -35,25 +38,102 @@ Device::Device(const VEDAdevice vedaId, const int aveoId, const int sensorId, co
 	m_aveoId		(aveoId),
 	m_sensorId		(sensorId),
 	m_numaId		(numaId),
-	m_isNUMA		(readSensor<bool>	("partitioning_mode")),
-	m_memorySize		(readSensor<size_t>	("memory_size") * 1024 * 1024 * 1024),
-	m_clockRate		(readSensor<int>	("clock_chip")),
-	m_clockBase		(readSensor<int>	("clock_base")),
-	m_clockMemory		(readSensor<int>	("clock_memory")),
-	m_cacheL1d		(readSensor<int>	("cache_l1d")),
-	m_cacheL1i		(readSensor<int>	("cache_l1i")),
-	m_cacheL2		(readSensor<int>	("cache_l2")),
-	m_cacheLLC		(readSensor<int>	("cache_llc") / (isNUMA() ? 2 : 1)),
-	m_versionAbi		(readSensor<int>	("abi_version")),
-	m_versionFirmware	(readSensor<int>	("fw_version")),
-	m_model			(readSensor<int>	("model")),
-	m_type			(readSensor<int>	("type")),
-	m_ctx			(*this)
+	m_props			(),
+	m_ctxReserved		(),
+	m_telemetry		(*this)
 {
+	for(int i = 0; i < VEDA_MAX_CONTEXTS; i++)
+		m_ctxs.emplace_back(*this, i);
+}
+
+//------------------------------------------------------------------------------
+Context& Device::ctx(const int ctxId) {
+	if(ctxId < 0 || ctxId >= contexts())
+		VEDA_THROW(VEDA_ERROR_INVALID_CONTEXT);
+	return m_ctxs[ctxId];
+}
+
+//------------------------------------------------------------------------------
+/** Returns a context of this device running in mode. A context that gets
+ * prewarmed with the same mode is used first, otherwise the first inactive
+ * one gets initialized. Each context owns an own VE process, pointer table
+ * and set of streams. m_ctxMutex only guards reserving the slot, so creating
+ * the VE process does not block other contexts of this device. */
+Context& Device::ctxCreate(const VEDAcontext_mode mode) {
+	auto& ctx = ctxReserve(mode);
+
+	try {
+		ctx.init(mode);
+	} catch(...) {
+		ctxRelease(ctx);
+		throw;
+	}
+
+	ctxRelease(ctx);
+	return ctx;
+}
+
+//------------------------------------------------------------------------------
+/** Reserves the slot of a context for ctxCreate. Slots that are active, get
+ * prewarmed or are reserved by another thread are skipped, only a prewarm
+ * with a different mode gets taken over if nothing else is left. */
+Context& Device::ctxReserve(const VEDAcontext_mode mode) {
+	std::lock_guard<std::mutex> __lock__(m_ctxMutex);
+	auto reserve = [this](Context& ctx) -> Context& {
+		m_ctxReserved[ctx.ctxId()] = true;
+		return ctx;
+	};
+
+	for(auto& ctx : m_ctxs)
+		if(!m_ctxReserved[ctx.ctxId()] && ctx.isPrewarming() && ctx.prewarmMode() == mode)
+			return reserve(ctx);
+
+	for(auto& ctx : m_ctxs)
+		if(!m_ctxReserved[ctx.ctxId()] && !ctx.isPrewarming() && !ctx.isActive())
+			return reserve(ctx);
+
+	for(auto& ctx : m_ctxs)
+		if(!m_ctxReserved[ctx.ctxId()] && ctx.isPrewarming())
+			return reserve(ctx);
+
+	VEDA_THROW(VEDA_ERROR_CANNOT_CREATE_CONTEXT);
+}
+
+//------------------------------------------------------------------------------
+void Device::ctxRelease(Context& ctx) {
+	std::lock_guard<std::mutex> __lock__(m_ctxMutex);
+	m_ctxReserved[ctx.ctxId()] = false;
+}
+
+//------------------------------------------------------------------------------
+const Device::Properties& Device::props(void) const {
+	std::call_once(m_propsOnce, &Device::loadProps, this);
+	return m_props;
+}
+
+//------------------------------------------------------------------------------
+/** If reading a sensor fails, the exception gets passed to the caller and the
+ * next call of props() tries again. */
+void Device::loadProps(void) const {
+	Properties p;
+	p.isNUMA		= readSensor<bool>	("partitioning_mode");
+	p.memorySize		= readSensor<size_t>	("memory_size") * 1024 * 1024 * 1024;
+	p.clockRate		= readSensor<int>	("clock_chip");
+	p.clockBase		= readSensor<int>	("clock_base");
+	p.clockMemory		= readSensor<int>	("clock_memory");
+	p.cacheL1d		= readSensor<int>	("cache_l1d");
+	p.cacheL1i		= readSensor<int>	("cache_l1i");
+	p.cacheL2		= readSensor<int>	("cache_l2");
+	p.cacheLLC		= readSensor<int>	("cache_llc") / (p.isNUMA ? 2 : 1);
+	p.versionAbi		= readSensor<int>	("abi_version");
+	p.versionFirmware	= readSensor<int>	("fw_version");
+	p.model			= readSensor<int>	("model");
+	p.type			= readSensor<int>	("type");
+
 	int active = 0;
-	if(isNUMA()) {
+	if(p.isNUMA) {
 		char buffer[SENSOR_BUFFER_SIZE];
-		snprintf(buffer, sizeof(buffer), "numa%i_cores", numaId);
+		snprintf(buffer, sizeof(buffer), "numa%i_cores", numaId());
 		active = readSensor<int>(buffer, true);
 	} else {
 		active = readSensor<int>("cores_enable", true);
@@ -63,7 +143,9 @@ Device::Device(const VEDAdevice vedaId, const int aveoId, const int sensorId, co
 	int bit = 1;
 	for(int i = 0; i < (sizeof(int)*8); i++, bit <<= 1)
 		if(active & bit)
-			m_cores.emplace_back(i);
+			p.cores.emplace_back(i);
+
+	m_props = std::move(p);
 }
 
 //------------------------------------------------------------------------------
@@ -71,17 +153,17 @@ float Device::coreTemp(const int coreIdx) const {
 	if(coreIdx < 0 || coreIdx >= cores())
 		VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
 	
-	auto sensor  = m_cores[coreIdx] + 14; // offseted by 14
-	char buffer[SENSOR_BUFFER_SIZE];
-	snprintf(buffer, sizeof(buffer), "sensor_%i", sensor);
-	return readSensor<float>(buffer)/1000000.0f;	
+	auto t = telemetry();
+	if(coreIdx >= t.cores)
+		VEDA_THROW(VEDA_ERROR_INVALID_COREIDX);
+	return t.coreTemp[coreIdx];
 }
 
 //------------------------------------------------------------------------------
 void Device::report(void) const {
 	printf("Device #%i [Aveo: %i, Sensor: %i, NUMA: %i, Cores: (", vedaId(), aveoId(), sensorId(), numaId());
 	bool isFirst = true;
-	for(auto core : m_cores) {
+	for(auto core : props().cores) {
 		if(isFirst)	isFirst = false;
 		else		printf(", ");
 		printf("%i", core);
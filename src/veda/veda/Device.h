@@ -4,27 +4,41 @@ namespace veda {
 	class Device final {
 		typedef std::vector<int>	Cores;
 
-			Cores			m_cores;
+		/** Attributes read from sysfs on first use, so processes only pay
+		 * for the devices they actually use. */
+		struct Properties {
+			Cores	cores;
+			bool	isNUMA;
+			size_t	memorySize;
+			int	clockRate;
+			int	clockBase;
+			int	clockMemory;
+			int	cacheL1d;
+			int	cacheL1i;
+			int	cacheL2;
+			int	cacheLLC;
+			int	versionAbi;
+			int	versionFirmware;
+			int	model;
+			int	type;
+		};
+
 		const	VEDAdevice		m_vedaId;
 		const	int			m_aveoId;
 		const	int			m_sensorId;
 		const	int			m_numaId;
-		const	bool			m_isNUMA;
-		const	size_t			m_memorySize;
-		const	int			m_clockRate;
-		const	int			m_clockBase;
-		const	int			m_clockMemory;
-		const	int			m_cacheL1d;
-		const	int			m_cacheL1i;
-		const	int			m_cacheL2;
-		const	int			m_cacheLLC;
-		const	int			m_versionAbi;
-		const	int			m_versionFirmware;
-		const	int			m_model;
-		const	int			m_type;
-			Context			m_ctx;
+		mutable	std::once_flag		m_propsOnce;
+		mutable	Properties		m_props;
+			std::deque<Context>	m_ctxs;
+			std::mutex		m_ctxMutex;
+			bool			m_ctxReserved[VEDA_MAX_CONTEXTS];
+		mutable	Telemetry		m_telemetry;
 
-		uint64_t	readSensor	(const char* file, const bool isHex) const;
+		Context&		ctxReserve	(const VEDAcontext_mode mode);
+		const Properties&	props		(void) const;
+		uint64_t		readSensor	(const char* file, const bool isHex) const;
+		void			ctxRelease	(Context& ctx);
+		void			loadProps	(void) const;
 
 		template<typename T>
 		inline T readSensor(const char* file, const bool isHex = false) const {
@@ -34,7 +48,9 @@ namespace veda {
 	public:
 				Device		(const VEDAdevice vedaId, const int aveoId, const int sensorId, const int numaId);
 				Device		(const Device&) = delete;
+		Context&	ctx		(const int ctxId);
 		Context&	ctx		(void);
+		Context&	ctxCreate	(const VEDAcontext_mode mode);
 		VEDAdevice	vedaId		(void) const;
 		bool		isNUMA		(void) const;
 		float		coreTemp	(const int core) const;
@@ -50,14 +66,17 @@ namespace veda {
 		int		clockBase	(void) const;
 		int		clockMemory	(void) const;
 		int		clockRate	(void) const;
+		int		contexts	(void) const;
 		int		cores		(void) const;
 		int		model		(void) const;
 		int		numaId		(void) const;
+		int		physicalCore	(const int core) const;
 		int		sensorId	(void) const;
 		int		type		(void) const;
 		int		versionAbi	(void) const;
 		int		versionFirmware	(void) const;
 		size_t		memorySize	(void) const;
+		VEDAtelemetry	telemetry	(void) const;
 		void		report		(void) const;
 	};
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "veda/internal.h"
-
-#define SYS_CLASS_VE_BUFFER_SIZE 128
+#include <climits>
+#include <sys/sysmacros.h>
 
 namespace veda {
 //------------------------------------------------------------------------------
@@ -12,19 +12,43 @@ int Devices::count(void) {
 }
 
 //------------------------------------------------------------------------------
+/** Destroys all contexts in parallel, as veo_proc_destroy blocks until the VE
+ * process has been terminated. */
 void Devices::shutdown(void) {
+	std::vector<std::future<void>> destroys;
 	for(auto& device : s_devices) {
-		auto& ctx = device.ctx();
-		if(ctx.isActive())
-			ctx.destroy();
+		for(int i = 0; i < device.contexts(); i++) {
+			auto& ctx = device.ctx(i);
+			destroys.emplace_back(std::async(std::launch::async, [&ctx] {
+				ctx.prewarmWait();
+				if(ctx.isActive())
+					ctx.destroy();
+			}));
+		}
+	}
+
+	// wait for all contexts before rethrowing, so none is still running
+	// when s_devices gets cleared
+	VEDAresult res = VEDA_SUCCESS;
+	for(auto& destroy : destroys) {
+		try {
+			destroy.get();
+		} catch(VEDAresult r) {
+			if(res == VEDA_SUCCESS)
+				res = r;
+		}
 	}
 	s_devices.clear();
+
+	if(res != VEDA_SUCCESS)
+		throw res;
 }
 
 //------------------------------------------------------------------------------
 void Devices::memReport(void) {
 	for(auto& d : s_devices)
-		d.ctx().memReport();
+		for(int i = 0; i < d.contexts(); i++)
+			d.ctx(i).memReport();
 }
 
 //------------------------------------------------------------------------------
@@ -40,6 +64,12 @@ Device& Devices::get(const VEDAdeviceptr vptr) {
 	return get(VEDA_GET_DEVICE(vptr));
 }
 
+//------------------------------------------------------------------------------
+/** Returns the context that allocated vptr. */
+Context& Devices::ctx(const VEDAdeviceptr vptr) {
+	return get(vptr).ctx(VEDA_GET_CTX(vptr));
+}
+
 //------------------------------------------------------------------------------
 Device& Devices::get(const VEDAdevice device) {
 	if(device < 0 || device >= count())
@@ -54,6 +84,38 @@ void Devices::init(void) {
 	initMapping	(devices);
 }
 
+//------------------------------------------------------------------------------
+/** Starts creating the contexts of the devices listed in VEDA_PREWARM, a comma
+ * separated list of VEDA device ids, in the background. If VEDA_PREWARM is not
+ * set, force prewarms device 0. VEDA_PREWARM_MODE=SCALAR prewarms scalar
+ * instead of OpenMP contexts. */
+void Devices::prewarm(const bool force) {
+	auto env = std::getenv("VEDA_PREWARM");
+	if(!env && !force)
+		return;
+
+	auto modeEnv	= std::getenv("VEDA_PREWARM_MODE");
+	auto mode	= modeEnv && strcasecmp(modeEnv, "SCALAR") == 0 ? VEDA_CONTEXT_MODE_SCALAR : VEDA_CONTEXT_MODE_OMP;
+
+	std::set<VEDAdevice> devices;
+	if(env) {
+		std::istringstream ss(env);
+		std::string line;
+		while(ss.good()) {
+			std::getline(ss, line, ',');
+			if(line.size())
+				devices.emplace(std::atoi(line.c_str()));
+			line.clear();
+		}
+	} else {
+		devices.emplace(0);
+	}
+
+	for(auto dev : devices)
+		if(dev >= 0 && dev < count())
+			s_devices[dev].ctx().prewarm(mode);
+}
+
 //------------------------------------------------------------------------------
 void Devices::initCount(std::set<int>& devices) {
 	assert(devices.empty());
@@ -123,7 +185,6 @@ void Devices::initMapping(const std::set<int>& devices) {
 	}
 
 	// Parse real device ids
-	char device[] = "/dev/veslotX";
 	for(int deviceIdx : devices) {
 		assert(deviceIdx < 10); // otherwise this will fail
 
@@ -134,35 +195,27 @@ void Devices::initMapping(const std::set<int>& devices) {
 
 		auto aveoId = it != mapping.end() ? it->second : deviceIdx;
 
-		// Determine Sensor ID
-		device[strlen(device) - 1] = '0' + (char)deviceIdx;
-
-		struct stat sb = {0};
-		if(stat(device, &sb) == -1)
-			VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
-
-		udev* udev = udev_new();
-		auto ve_udev = udev_device_new_from_devnum(udev, 'c', sb.st_rdev);
-		if(!ve_udev)
-			VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
-
-		auto sysfs_path = udev_device_get_syspath(ve_udev);
-		if(!sysfs_path)
-			VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
-
-		char real_device_idx = sysfs_path[strlen(sysfs_path)-1];
-		udev_device_unref(ve_udev);
-		udev_unref(udev);
+		// Skip devices that are not visible before touching sysfs
+		int maxNumaId = 1;
+		if(visible.size()) {
+			maxNumaId = -1;
+			for(auto& [visibleAveoId, visibleNumaId] : visible)
+				if(visibleAveoId == aveoId)
+					maxNumaId = std::max(maxNumaId, visibleNumaId);
+			if(maxNumaId < 0)
+				continue;
+		}
 
-		auto sensorId = (int)(real_device_idx - '0');
+		auto sensorId = initSensorId(deviceIdx);
 
-		// Determine NUMA count
-		int numaCnt = readSensor(sensorId, "partitioning_mode", false) ? 2 : 1;
+		// Determine NUMA count, NUMA node 0 always exists
+		int numaCnt = maxNumaId > 0 && readSensor(sensorId, "partitioning_mode", false) ? 2 : 1;
 
 		for(int numaId = 0; numaId < numaCnt; numaId++) {
 			if(visible.size() && visible.find({aveoId, numaId}) == visible.end())
 				continue;
 
+			// All other attributes get read on first use, see Device::props
 			auto vedaId = (VEDAdevice)s_devices.size();
 			s_devices.emplace_back(vedaId, aveoId, sensorId, numaId);
 		}
@@ -170,22 +223,50 @@ void Devices::initMapping(const std::set<int>& devices) {
 }
 
 //------------------------------------------------------------------------------
-uint64_t Devices::readSensor(const int sensorId, const char* file, const bool isHex) {
-	if(file == 0)
-		VEDA_THROW(VEDA_ERROR_NO_SENSOR_FILE);
+/** Determines the sysfs index of /dev/veslot<deviceIdx>. /sys/dev/char/<major>:<minor>
+ * links to the sysfs directory of the device, so in most cases no udev context
+ * needs to be created. */
+int Devices::initSensorId(const int deviceIdx) {
+	char device[] = "/dev/veslotX";
+	device[strlen(device) - 1] = '0' + (char)deviceIdx;
+
+	struct stat sb = {0};
+	if(stat(device, &sb) == -1)
+		VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
+
+	char link[PATH_MAX], path[PATH_MAX];
+	snprintf(link, sizeof(link), "/sys/dev/char/%u:%u", major(sb.st_rdev), minor(sb.st_rdev));
+	auto len = readlink(link, path, sizeof(path) - 1);
+	if(len > 0)
+		return (int)(path[len - 1] - '0');
 
-	char buffer[SYS_CLASS_VE_BUFFER_SIZE];
-	snprintf(buffer, sizeof(buffer), "/sys/class/ve/ve%i/%s", sensorId, file);
+	udev* udev = udev_new();
+	auto ve_udev = udev_device_new_from_devnum(udev, 'c', sb.st_rdev);
+	if(!ve_udev)
+		VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
 
-	uint64_t value = 0;
-	std::ifstream f(buffer, std::ios::binary);
-	if(!f.good())
-		VEDA_THROW(VEDA_ERROR_CANT_READ_SENSOR_FILE);
-	if(isHex)	f >> std::hex >> value;
-	else		f >> value;
-	f.close();
+	auto sysfs_path = udev_device_get_syspath(ve_udev);
+	if(!sysfs_path)
+		VEDA_THROW(VEDA_ERROR_INITIALIZING_DEVICE);
 
-	return value;
+	char real_device_idx = sysfs_path[strlen(sysfs_path)-1];
+	udev_device_unref(ve_udev);
+	udev_unref(udev);
+
+	return (int)(real_device_idx - '0');
+}
+
+//------------------------------------------------------------------------------
+uint64_t Devices::readSensor(const int sensorId, const char* file, const bool isHex) {
+	auto fd = Telemetry::open(sensorId, file);
+	try {
+		auto value = Telemetry::read(fd, isHex);
+		close(fd);
+		return value;
+	} catch(...) {
+		close(fd);
+		throw;
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -6,14 +6,17 @@ namespace veda {
 
 		static	void		initCount	(std::set<int>& devices);
 		static	void		initMapping	(const std::set<int>& devices);
+		static	int		initSensorId	(const int deviceIdx);
 
 	public:
 		static	Device&		get		(const VEDAdevice device);
 		static	Device&		get		(const VEDAdeviceptr ptr);
+		static	Context&	ctx		(const VEDAdeviceptr ptr);
 		static	int		count		(void);
 		static	uint64_t	readSensor	(const int sensorId, const char* file, const bool isHex);
 		static	void		init		(void);
 		static	void		memReport	(void);
+		static	void		prewarm		(const bool force);
 		static	void		report		(void);
 		static	void		shutdown	(void);
 	};
@@ -2,7 +2,20 @@
 
 namespace veda {
 	struct Guard {
-		inline	Guard	(void)	{	checkInitialized(); Semaphore::acquire();	}
-		inline	~Guard	(void)	{	Semaphore::release();				}
+		const char*	m_func;
+		uint64_t	m_begin;
+
+		inline	Guard	(const char* func) : m_func(func), m_begin(0) {
+			checkInitialized();
+			Semaphore::acquire();
+			if(Trace::enabled())
+				m_begin = Trace::now();
+		}
+
+		inline	~Guard	(void) {
+			if(m_begin && Trace::enabled())
+				Trace::api(m_func, m_begin);
+			Semaphore::release();
+		}
 	};
 }
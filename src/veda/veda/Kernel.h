@@ -11,11 +11,22 @@ enum Kernel {
 	VEDA_KERNEL_MEMSET_U32_2D,
 	VEDA_KERNEL_MEMSET_U64_2D,
 	VEDA_KERNEL_MEMSET_U128_2D,
+	VEDA_KERNEL_MEMSET_U8_3D,
 	VEDA_KERNEL_MEMCPY_D2D,
+	VEDA_KERNEL_MEMOPS,
 	VEDA_KERNEL_MEM_ALLOC,
 	VEDA_KERNEL_MEM_FREE,
 	VEDA_KERNEL_MEM_PTR,
 	VEDA_KERNEL_MEM_SIZE,
 	VEDA_KERNEL_MEM_SWAP,
+	VEDA_KERNEL_CTX_GET_LIMIT,
+	VEDA_KERNEL_CTX_SET_LIMIT,
+	VEDA_KERNEL_CTX_TUNE_LIMITS,
+	VEDA_KERNEL_SCAN,
+	VEDA_KERNEL_SORT,
+	VEDA_KERNEL_COMPACT,
+	VEDA_KERNEL_HISTOGRAM,
+	VEDA_KERNEL_MEM_ALLOC_EX,
+	VEDA_KERNEL_PERSISTENT,
 	VEDA_KERNEL_CNT
 };
\ No newline at end of file
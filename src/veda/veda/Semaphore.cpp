@@ -2,13 +2,34 @@
 
 namespace veda {
 //------------------------------------------------------------------------------
-std::atomic<uint32_t>	Semaphore::s_count;
-std::atomic<int>	Semaphore::s_shutdown;
+Semaphore::Shard		Semaphore::s_shards[SHARDS];
+std::atomic<uint32_t>		Semaphore::s_next;
+alignas(64) std::atomic<int>	Semaphore::s_shutdown;
+std::mutex			Semaphore::s_mutex;
+std::condition_variable		Semaphore::s_cond;
+
+//------------------------------------------------------------------------------
+/** Threads get assigned round robin to the shards on their first API call.
+ * acquire and release of a call always run on the same thread, so each shard
+ * on its own never drops below 0. */
+Semaphore::Shard& Semaphore::shard(void) {
+	thread_local Shard* t_shard = &s_shards[s_next.fetch_add(1, std::memory_order_relaxed) % SHARDS];
+	return *t_shard;
+}
+
+//------------------------------------------------------------------------------
+int64_t Semaphore::count(void) {
+	int64_t cnt = 0;
+	for(auto& s : s_shards)
+		cnt += s.count.load();
+	return cnt;
+}
 
 //------------------------------------------------------------------------------
 void Semaphore::init(void) {
-	s_shutdown	= 0;
-	s_count		= 0;
+	s_shutdown = 0;
+	for(auto& s : s_shards)
+		s.count = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -16,21 +37,33 @@ void Semaphore::shutdown(void) {
 	if(s_shutdown.load())
 		VEDA_THROW(VEDA_ERROR_UNKNOWN);
 	s_shutdown++;
-	// wait until all other requests have been dealt with
-	while(s_count.load() != 0)
-		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	// wait until all other requests have been dealt with, see release
+	std::unique_lock<std::mutex> lock(s_mutex);
+	s_cond.wait(lock, [] { return count() == 0; });
 }
 
 //------------------------------------------------------------------------------
+/** Increments before checking s_shutdown, so shutdown either sees this call
+ * in count() or this call sees the shutdown. */
 void Semaphore::acquire(void) {
-	if(s_shutdown.load())
+	auto& s = shard();
+	s.count++;
+	if(s_shutdown.load()) {
+		release();
 		VEDA_THROW(VEDA_ERROR_SHUTTING_DOWN);
-	s_count++;
+	}
 }
 
 //------------------------------------------------------------------------------
+/** Only wakes up shutdown if it is waiting. Either shutdown sees the decrement
+ * when evaluating its predicate, or this call sees s_shutdown and notifies
+ * while holding s_mutex, so the wake up cannot get lost. */
 void Semaphore::release(void) {
-	s_count--;
+	shard().count--;
+	if(s_shutdown.load()) {
+		std::lock_guard<std::mutex> lock(s_mutex);
+		s_cond.notify_all();
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -2,8 +2,22 @@
 
 namespace veda {
 	class Semaphore {
-		static std::atomic<uint32_t>	s_count;
-		static std::atomic<int>		s_shutdown;
+		/** Counts the API calls in flight. Each thread uses one of SHARDS
+		 * counters, each in its own cache line, so concurrent API calls
+		 * do not contend on a single atomic. */
+		struct alignas(64) Shard {
+			std::atomic<int32_t>	count;
+		};
+
+		static constexpr int		SHARDS = 64;
+		static Shard			s_shards[SHARDS];
+		static std::atomic<uint32_t>	s_next;
+		alignas(64) static std::atomic<int>	s_shutdown;
+		static std::mutex		s_mutex;
+		static std::condition_variable	s_cond;
+
+		static Shard&	shard		(void);
+		static int64_t	count		(void);
 
 	public:
 		static void acquire	(void);
@@ -11,4 +25,4 @@ namespace veda {
 		static void release	(void);
 		static void shutdown	(void);
 	};
-}
\ No newline at end of file
+}
@@ -1,12 +1,32 @@
 #pragma once
 
+/** Marks entries of Stream::calls that are commands in the persistent ring. */
+#define VEDA_PERSISTENT_REQ (1ull << 63)
+
 namespace veda {
+	struct PackedArgs {
+		VEDAargs	args;
+		uint64_t	regs[VEDA_PERSISTENT_ARGS];
+		int		cnt;
+		bool		valid;
+
+		inline PackedArgs(VEDAargs _args) : args(_args), regs{}, cnt(0), valid(true) {}
+	};
+
 	struct Stream {
 		veo_thr_ctxt*						ctx;
-		std::vector<std::tuple<uint64_t, bool, uint64_t*>>	calls;
+		std::vector<std::tuple<uint64_t, bool, uint64_t*, uint64_t>>	calls;	// request, checkResult, result, launch time of application kernels
 		std::mutex						mutex;
+		VEDAdeviceptr						ring;		// command ring, 0 if not persistent
+		veo_ptr							ringPtr;	// device address of the ring
+		char*							ringHmem;	// HMEM address of the ring
+		uint64_t						ringPos;	// position of the next command
+		uint64_t						ringSynced;	// position up to which all results got collected
+		uint64_t						ringLoop;	// request of the running persistent loop
+		uint64_t						inFlight;	// application kernels enqueued since the last sync
+		uint64_t						lastDone;	// time at which the last call got completed
 
-		inline Stream(void)	: ctx(0) {}
-		inline Stream(Stream&&)	: ctx(0) {}
+		inline Stream(void)	: ctx(0), ring(0), ringPtr(0), ringHmem(0), ringPos(0), ringSynced(0), ringLoop(VEO_REQUEST_ID_INVALID), inFlight(0), lastDone(0) {}
+		inline Stream(Stream&&)	: Stream() {}
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,115 @@
+#include "veda/internal.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+#define SYS_CLASS_VE_BUFFER_SIZE	128
+#define SENSOR_BUFFER_SIZE		16
+#define SENSOR_VALUE_BUFFER_SIZE	32
+
+/** Order of the power sensors in Telemetry::m_fds, followed by one temperature
+ * sensor per core. */
+#define SENSOR_VOLTAGE		0
+#define SENSOR_VOLTAGE_EDGE	1
+#define SENSOR_CURRENT		2
+#define SENSOR_CURRENT_EDGE	3
+#define SENSOR_CORES		4
+
+namespace veda {
+//------------------------------------------------------------------------------
+Telemetry::Telemetry(const Device& device) :
+	m_device(device),
+	m_cache	()
+{}
+
+//------------------------------------------------------------------------------
+Telemetry::~Telemetry(void) {
+	for(auto fd : m_fds)
+		::close(fd);
+}
+
+//------------------------------------------------------------------------------
+int Telemetry::open(const int sensorId, const char* file) {
+	if(file == 0)
+		VEDA_THROW(VEDA_ERROR_NO_SENSOR_FILE);
+
+	char buffer[SYS_CLASS_VE_BUFFER_SIZE];
+	snprintf(buffer, sizeof(buffer), "/sys/class/ve/ve%i/%s", sensorId, file);
+
+	int fd = ::open(buffer, O_RDONLY | O_CLOEXEC);
+	if(fd < 0)
+		VEDA_THROW(VEDA_ERROR_CANT_READ_SENSOR_FILE);
+	return fd;
+}
+
+//------------------------------------------------------------------------------
+/** sysfs regenerates the content of an attribute whenever it gets read from
+ * offset 0, so the file can stay open and gets read with pread. */
+uint64_t Telemetry::read(const int fd, const bool isHex) {
+	char buffer[SENSOR_VALUE_BUFFER_SIZE];
+	auto len = ::pread(fd, buffer, sizeof(buffer) - 1, 0);
+	if(len <= 0)
+		VEDA_THROW(VEDA_ERROR_CANT_READ_SENSOR_FILE);
+	buffer[len] = 0;
+	return std::strtoull(buffer, 0, isHex ? 16 : 10);
+}
+
+//------------------------------------------------------------------------------
+void Telemetry::open(void) {
+	if(!m_fds.empty())
+		return;
+
+	std::vector<int> fds;
+	try {
+		for(auto file : {"sensor_8", "sensor_9", "sensor_12", "sensor_13"})
+			fds.emplace_back(open(m_device.sensorId(), file));
+
+		char buffer[SENSOR_BUFFER_SIZE];
+		auto cores = std::min(m_device.cores(), VEDA_TELEMETRY_MAX_CORES);
+		for(int i = 0; i < cores; i++) {
+			snprintf(buffer, sizeof(buffer), "sensor_%i", m_device.physicalCore(i) + 14); // offseted by 14
+			fds.emplace_back(open(m_device.sensorId(), buffer));
+		}
+	} catch(...) {
+		for(auto fd : fds)
+			::close(fd);
+		throw;
+	}
+
+	m_fds.swap(fds);
+}
+
+//------------------------------------------------------------------------------
+void Telemetry::update(const uint64_t now) {
+	open();
+
+	const float numa	= m_device.isNUMA() ? 2.0f : 1.0f;
+	m_cache.voltage		= read(m_fds[SENSOR_VOLTAGE],		false) / 1000000.0f;
+	m_cache.voltageEdge	= read(m_fds[SENSOR_VOLTAGE_EDGE],	false) / 1000000.0f;
+	m_cache.current		= read(m_fds[SENSOR_CURRENT],		false) / 1000.0f / numa;
+	m_cache.currentEdge	= read(m_fds[SENSOR_CURRENT_EDGE],	false) / 1000.0f / numa;
+	m_cache.power		= m_cache.voltage * m_cache.current + m_cache.voltageEdge * m_cache.currentEdge + 5.0f;
+	m_cache.cores		= (int)(m_fds.size() - SENSOR_CORES);
+
+	for(int i = 0; i < m_cache.cores; i++)
+		m_cache.coreTemp[i] = read(m_fds[SENSOR_CORES + i], false) / 1000000.0f;
+
+	m_cache.timestamp = now;
+}
+
+//------------------------------------------------------------------------------
+/** Returns the cached snapshot if it is younger than VEDA_TELEMETRY_TTL,
+ * otherwise reads all sensors of the device in one pass. */
+VEDAtelemetry Telemetry::get(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	const uint64_t now = uint64_t(ts.tv_sec) * 1000000000llu + uint64_t(ts.tv_nsec);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if(m_cache.timestamp == 0 || (now - m_cache.timestamp) >= telemetryTTL() * 1000000llu)
+		update(now);
+	return m_cache;
+}
+
+//------------------------------------------------------------------------------
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace veda {
+	class Telemetry final {
+		const	Device&			m_device;
+			std::mutex		m_mutex;
+			std::vector<int>	m_fds;
+			VEDAtelemetry		m_cache;
+
+		void		open		(void);
+		void		update		(const uint64_t now);
+
+	public:
+				Telemetry	(const Device& device);
+				Telemetry	(const Telemetry&) = delete;
+				~Telemetry	(void);
+		VEDAtelemetry	get		(void);
+
+		static	int		open	(const int sensorId, const char* file);
+		static	uint64_t	read	(const int fd, const bool isHex);
+	};
+}
\ No newline at end of file
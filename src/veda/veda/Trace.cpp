@@ -0,0 +1,190 @@
+#include "veda/internal.h"
+#include <algorithm>
+#include <sys/syscall.h>
+
+/** Chrome trace process id of the tracks of VE contexts, above any Linux pid. */
+#define TRACE_PID_VE		(1 << 22)
+#define TRACE_DEFAULT_SIZE	65536
+
+namespace veda {
+//------------------------------------------------------------------------------
+std::atomic<bool>	Trace::s_enabled(false);
+std::mutex		Trace::s_mutex;
+std::vector<Trace::Ring*> Trace::s_rings;
+std::string		Trace::s_file;
+size_t			Trace::s_size		= TRACE_DEFAULT_SIZE;
+uint64_t		Trace::s_generation	= 0;
+uint64_t		Trace::s_tsc		= 0;
+uint64_t		Trace::s_ns		= 0;
+
+//------------------------------------------------------------------------------
+static inline uint64_t nsNow(void) {
+	return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//------------------------------------------------------------------------------
+void Trace::init(void) {
+	auto file = std::getenv("VEDA_TRACE");
+	if(!file || !*file) {
+		s_enabled.store(false, std::memory_order_relaxed);
+		return;
+	}
+
+	s_file = file;
+	auto size = std::getenv("VEDA_TRACE_SIZE");
+	s_size = size && std::atoll(size) > 0 ? (size_t)std::atoll(size) : TRACE_DEFAULT_SIZE;
+	s_tsc = now();
+	s_ns  = nsNow();
+	s_enabled.store(true, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+/** Returns the next record of the calling thread's ring, overwriting the oldest
+ * one if the ring is full. Rings outlive their threads until shutdown, so
+ * short lived threads still show up in the trace. */
+Trace::Record& Trace::next(void) {
+	thread_local Ring*	t_ring		= 0;
+	thread_local uint64_t	t_generation	= 0;
+
+	if(!t_ring || t_generation != s_generation) {
+		std::lock_guard<std::mutex> __lock__(s_mutex);
+		t_ring		= new Ring{(int)syscall(SYS_gettid), 0, std::vector<Record>(s_size)};
+		t_generation	= s_generation;
+		s_rings.emplace_back(t_ring);
+	}
+
+	return t_ring->records[t_ring->pos++ % t_ring->records.size()];
+}
+
+//------------------------------------------------------------------------------
+void Trace::api(const char* name, const uint64_t begin) {
+	auto end = now();
+	auto& r	 = next();
+	r = {begin, end, 0, 0, {}, name, -1, -1, API, -1};
+}
+
+//------------------------------------------------------------------------------
+void Trace::submit(const Type type, const int device, const int ctx, const int stream, const uint64_t req, const uint64_t value) {
+	auto& r	= next();
+	r = {now(), 0, req, value, {}, 0, (int16_t)device, (int8_t)ctx, type, stream};
+}
+
+//------------------------------------------------------------------------------
+/** counters are the device counters of persistent stream commands, all 0 for
+ * other calls, which also pass a clockRate of 0. */
+void Trace::wait(const int device, const int ctx, const int stream, const uint64_t req, const uint64_t begin, const uint64_t* counters, const int clockRate) {
+	auto end = now();
+	auto& r	 = next();
+	r = {begin, end, req, (uint64_t)clockRate, {}, 0, (int16_t)device, (int8_t)ctx, WAIT, stream};
+	memcpy(r.counters, counters, sizeof(r.counters));
+}
+
+//------------------------------------------------------------------------------
+/** Needs to be called after all API calls have finished, see vedaExit. */
+void Trace::shutdown(void) {
+	if(!s_enabled.exchange(false))
+		return;
+
+	std::lock_guard<std::mutex> __lock__(s_mutex);
+	auto ticks	= now() - s_tsc;
+	auto ns		= nsNow() - s_ns;
+	auto nsPerTick	= ticks ? double(ns) / double(ticks) : 1.0;
+
+	auto file = fopen(s_file.c_str(), "w");
+	if(file) {
+		write(file, nsPerTick);
+		fclose(file);
+	} else {
+		L_WARN("Unable to write VEDA_TRACE file %s", s_file.c_str());
+	}
+
+	for(auto ring : s_rings)
+		delete ring;
+	s_rings.clear();
+	s_generation++;
+}
+
+//------------------------------------------------------------------------------
+/** API calls and waits are shown on the track of the host thread. Every VE
+ * context gets an own process with one track per stream, showing the time
+ * from submitting an operation until the host observed its completion. Kernels
+ * of persistent streams additionally get their device side duration and
+ * counters attached. */
+void Trace::write(FILE* file, const double nsPerTick) {
+	auto pid	= (int)getpid();
+	auto us		= [&](const uint64_t tsc) { return double(int64_t(tsc - s_tsc)) * nsPerTick / 1000.0; };
+	auto track	= [](const Record& r) { return TRACE_PID_VE + r.device * VEDA_MAX_CONTEXTS + r.ctx; };
+	const char* sep = "";
+
+	fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+	// Records in order of their begin, paired by the request they belong to
+	std::vector<std::tuple<int, const Record*>> records;
+	for(auto ring : s_rings) {
+		auto cnt = std::min<uint64_t>(ring->pos, ring->records.size());
+		for(uint64_t i = ring->pos - cnt; i < ring->pos; i++)
+			records.emplace_back(ring->tid, &ring->records[i % ring->records.size()]);
+	}
+	std::sort(records.begin(), records.end(), [](auto& a, auto& b) { return std::get<1>(a)->begin < std::get<1>(b)->begin; });
+
+	std::map<std::tuple<int, int, int, uint64_t>, const Record*> submitted;
+	std::map<std::tuple<int, int, int>, uint64_t> streamEnd;
+	std::set<std::tuple<int, int>> tracks;
+
+	for(auto& [tid, r] : records) {
+		switch(r->type) {
+		case API:
+			fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%i,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f}", sep, r->name, pid, tid, us(r->begin), us(r->end) - us(r->begin));
+			break;
+
+		case CALL:
+		case HOST_CALL:
+		case MEMCPY_D2H:
+		case MEMCPY_H2D:
+			submitted[{r->device, r->ctx, r->stream, r->req}] = r;
+			fprintf(file, "%s{\"name\":\"submit\",\"ph\":\"i\",\"s\":\"t\",\"pid\":%i,\"tid\":%i,\"ts\":%.3f,\"args\":{\"device\":%i,\"ctx\":%i,\"stream\":%i,\"value\":%llu}}", sep, pid, tid, us(r->begin), r->device, r->ctx, r->stream, (unsigned long long)r->value);
+			break;
+
+		case WAIT: {
+			fprintf(file, "%s{\"name\":\"wait\",\"ph\":\"X\",\"pid\":%i,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"device\":%i,\"ctx\":%i,\"stream\":%i}}", sep, pid, tid, us(r->begin), us(r->end) - us(r->begin), r->device, r->ctx, r->stream);
+
+			auto it = submitted.find({r->device, r->ctx, r->stream, r->req});
+			if(it == submitted.end())
+				break;
+			auto s = it->second;
+			submitted.erase(it);
+
+			// operations of a stream run in order, so one cannot start
+			// before the previous one has finished
+			auto& last	= streamEnd[{r->device, r->ctx, r->stream}];
+			auto begin	= std::max(s->begin, last);
+			last		= std::max(begin, r->end);
+			tracks.emplace(track(*r), r->stream);
+
+			const char* name = s->type == CALL ? "kernel" : s->type == HOST_CALL ? "host function" : s->type == MEMCPY_D2H ? "memcpyD2H" : "memcpyH2D";
+			const char* arg  = s->type == MEMCPY_D2H || s->type == MEMCPY_H2D ? "bytes" : "function";
+			fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%i,\"tid\":%i,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"%s\":%llu", name, track(*r), r->stream, us(begin), us(last) - us(begin), arg, (unsigned long long)s->value);
+			if(r->counters[0] && r->value) {
+				auto c = r->counters;
+				fprintf(file, ",\"ve_us\":%.3f,\"cycles\":%llu,\"pmc00\":%llu,\"pmc01\":%llu,\"pmc02\":%llu", double(c[0]) / double(r->value), (unsigned long long)c[0], (unsigned long long)c[1], (unsigned long long)c[2], (unsigned long long)c[3]);
+			}
+			fprintf(file, "}}");
+		}	break;
+		}
+		sep = ",\n";
+	}
+
+	// Names of the VE tracks
+	std::set<int> processes;
+	for(auto& [p, stream] : tracks) {
+		if(processes.emplace(p).second)
+			fprintf(file, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%i,\"args\":{\"name\":\"VE#%i.%i\"}}", sep, p, (p - TRACE_PID_VE) / VEDA_MAX_CONTEXTS, (p - TRACE_PID_VE) % VEDA_MAX_CONTEXTS);
+		sep = ",\n";
+		fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%i,\"tid\":%i,\"args\":{\"name\":\"stream %i\"}}", sep, p, stream, stream);
+	}
+
+	fprintf(file, "\n]}\n");
+}
+
+//------------------------------------------------------------------------------
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+namespace veda {
+	/** Binary trace of API calls and stream operations, enabled by setting
+	 * VEDA_TRACE=<file.json>. Every thread records into its own ring buffer
+	 * of VEDA_TRACE_SIZE records, which gets written as Chrome trace JSON
+	 * in vedaExit, so it can be opened with chrome://tracing or Perfetto. */
+	class Trace {
+	public:
+		enum Type : int8_t {
+			API,		///< API call, begin to end
+			CALL,		///< kernel submitted to a stream, value = function
+			HOST_CALL,	///< host function submitted to a stream, value = function
+			MEMCPY_D2H,	///< memcpy submitted to a stream, value = bytes
+			MEMCPY_H2D,	///< memcpy submitted to a stream, value = bytes
+			WAIT		///< waiting for the result of req, begin to end, value = VE clock in MHz for persistent streams, else 0
+		};
+
+	private:
+		struct Record {
+			uint64_t	begin;
+			uint64_t	end;
+			uint64_t	req;
+			uint64_t	value;
+			uint64_t	counters[VEDA_PERSISTENT_COUNTERS];
+			const char*	name;
+			int16_t		device;
+			int8_t		ctx;
+			Type		type;
+			int32_t		stream;
+		};
+
+		struct Ring {
+			int			tid;
+			uint64_t		pos;
+			std::vector<Record>	records;
+		};
+
+		static	std::atomic<bool>	s_enabled;
+		static	std::mutex		s_mutex;
+		static	std::vector<Ring*>	s_rings;
+		static	std::string		s_file;
+		static	size_t			s_size;
+		static	uint64_t		s_generation;
+		static	uint64_t		s_tsc;
+		static	uint64_t		s_ns;
+
+		static	Record&	next	(void);
+		static	void	write	(FILE* file, const double nsPerTick);
+
+	public:
+		static	inline	bool	enabled	(void) { return s_enabled.load(std::memory_order_relaxed); }
+		static	inline	uint64_t now	(void) {
+		#if defined(__x86_64__)
+			return __rdtsc();
+		#else
+			return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+		#endif
+		}
+
+		static	void	api	(const char* name, const uint64_t begin);
+		static	void	init	(void);
+		static	void	shutdown(void);
+		static	void	submit	(const Type type, const int device, const int ctx, const int stream, const uint64_t req, const uint64_t value);
+		static	void	wait	(const int device, const int ctx, const int stream, const uint64_t req, const uint64_t begin, const uint64_t* counters, const int clockRate);
+	};
+}
@@ -36,17 +36,24 @@ VEDAresult	vedaArgsSetU16			(VEDAargs args, const int idx, const uint16_t value)
 VEDAresult	vedaArgsSetU32			(VEDAargs args, const int idx, const uint32_t value);
 VEDAresult	vedaArgsSetU64			(VEDAargs args, const int idx, const uint64_t value);
 VEDAresult	vedaArgsSetU8			(VEDAargs args, const int idx, const uint8_t value);
+VEDAresult	vedaChannelCreate		(VEDAdeviceptr* channel, size_t recordSize, size_t capacity);
+VEDAresult	vedaChannelPoll			(VEDAdeviceptr channel, void* records, size_t maxRecords, size_t* cnt);
+VEDAresult	vedaCompact			(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, size_t cnt, VEDAdtype dtype, VEDAdeviceptr pcnt);
+VEDAresult	vedaCompactAsync		(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, size_t cnt, VEDAdtype dtype, VEDAdeviceptr pcnt, VEDAstream hStream);
 VEDAresult	vedaCtxCreate			(VEDAcontext* pctx, int mode, VEDAdevice dev);
 VEDAresult	vedaCtxDestroy			(VEDAcontext ctx);
 VEDAresult	vedaCtxGet			(VEDAcontext* ctx, const VEDAdevice device);
 VEDAresult	vedaCtxGetApiVersion		(VEDAcontext ctx, uint32_t* version);
 VEDAresult	vedaCtxGetCurrent		(VEDAcontext* pctx);
 VEDAresult	vedaCtxGetDevice		(VEDAdevice* device);
+VEDAresult	vedaCtxGetLimit			(size_t* pvalue, VEDAlimit limit);
 VEDAresult	vedaCtxPopCurrent		(VEDAcontext* pctx);
 VEDAresult	vedaCtxPushCurrent		(VEDAcontext ctx);
 VEDAresult	vedaCtxSetCurrent		(VEDAcontext ctx);
+VEDAresult	vedaCtxSetLimit			(VEDAlimit limit, size_t value);
 VEDAresult	vedaCtxStreamCnt		(int* cnt);
 VEDAresult	vedaCtxSynchronize		(void);
+VEDAresult	vedaCtxTuneLimits		(void);
 VEDAresult	vedaDeviceDistance		(float* distance, VEDAdevice devA, VEDAdevice devB);
 VEDAresult	vedaDeviceGet			(VEDAdevice* device, int ordinal);
 VEDAresult	vedaDeviceGetAVEOId		(int* id, VEDAdevice dev);
@@ -58,6 +65,8 @@ VEDAresult	vedaDeviceGetNUMAId		(int* id, VEDAdevice dev);
 VEDAresult	vedaDeviceGetName 		(char* name, int len, VEDAdevice dev);
 VEDAresult	vedaDeviceGetPhysicalId		(int* id, VEDAdevice dev);
 VEDAresult	vedaDeviceGetPower		(float* power, VEDAdevice dev);
+VEDAresult	vedaDeviceGetProcesses		(VEDAprocessUsage* usage, int* cnt, VEDAdevice dev);
+VEDAresult	vedaDeviceGetTelemetry		(VEDAtelemetry* telemetry, VEDAdevice dev);
 VEDAresult	vedaDeviceGetTemp		(float* tempC, const int coreIdx, VEDAdevice dev);
 VEDAresult	vedaDeviceGetVoltage		(float* voltage, VEDAdevice dev);
 VEDAresult	vedaDeviceGetVoltageEdge	(float* voltage, VEDAdevice dev);
@@ -72,6 +81,8 @@ VEDAresult	vedaExit			(void);
 VEDAresult	vedaGetErrorName		(VEDAresult error, const char** pStr);
 VEDAresult	vedaGetErrorString		(VEDAresult error, const char** pStr);
 VEDAresult	vedaGetVersion			(const char** str);
+VEDAresult	vedaHistogram			(VEDAdeviceptr bins, size_t nbins, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype);
+VEDAresult	vedaHistogramAsync		(VEDAdeviceptr bins, size_t nbins, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, VEDAstream hStream);
 VEDAresult	vedaInit			(uint32_t Flags);
 VEDAresult	vedaLaunchHostFunc		(VEDAstream stream, VEDAhost_function fn, void* userData);
 VEDAresult	vedaLaunchHostFuncEx		(VEDAstream stream, VEDAhost_function fn, void* userData, uint64_t* result);
@@ -79,6 +90,8 @@ VEDAresult	vedaLaunchKernel		(VEDAfunction f, VEDAstream stream, VEDAargs);
 VEDAresult	vedaLaunchKernelEx		(VEDAfunction f, VEDAstream stream, VEDAargs, const int destroyArgs, uint64_t* result);
 VEDAresult	vedaMemAlloc			(VEDAdeviceptr* ptr, size_t size);
 VEDAresult	vedaMemAllocAsync		(VEDAdeviceptr* ptr, size_t size, VEDAstream stream);
+VEDAresult	vedaMemAllocAsyncEx		(VEDAdeviceptr* ptr, size_t size, VEDAmem_placement placement, int node, VEDAstream stream);
+VEDAresult	vedaMemAllocEx			(VEDAdeviceptr* ptr, size_t size, VEDAmem_placement placement, int node);
 VEDAresult	vedaMemAllocHost		(void** pp, size_t bytesiz);
 VEDAresult	vedaMemAllocOverrideOnce	(VEDAdeviceptr ptr);
 VEDAresult	vedaMemAllocPitch		(VEDAdeviceptr* ptr, size_t* pPitch, size_t WidthInBytes, size_t Height, uint32_t ElementSizeByte);
@@ -91,6 +104,8 @@ VEDAresult	vedaMemGetDevice		(VEDAdevice* dev, VEDAdeviceptr ptr);
 VEDAresult	vedaMemGetInfo			(size_t* free, size_t* total);
 VEDAresult	vedaMemHMEM			(void** ptr, VEDAdeviceptr vptr);
 VEDAresult	vedaMemHMEMSize			(void** ptr, size_t* size, VEDAdeviceptr vptr);
+VEDAresult	vedaMemOps			(const VEDAmemop* ops, int n);
+VEDAresult	vedaMemOpsAsync			(const VEDAmemop* ops, int n, VEDAstream hStream);
 VEDAresult	vedaMemPtr			(void** ptr, VEDAdeviceptr vptr);
 VEDAresult	vedaMemPtrSize			(void** ptr, size_t* size, VEDAdeviceptr vptr);
 VEDAresult	vedaMemReport			(void);
@@ -120,6 +135,8 @@ VEDAresult	vedaMemsetD2D64Async		(VEDAdeviceptr dstDevice, size_t dstPitch, uint
 VEDAresult	vedaMemsetD2D8			(VEDAdeviceptr dstDevice, size_t dstPitch, uint8_t uc, size_t Width, size_t Height);
 VEDAresult	vedaMemsetD2D8Async		(VEDAdeviceptr dstDevice, size_t dstPitch, uint8_t uc, size_t Width, size_t Height, VEDAstream hStream);
 VEDAresult	vedaMemsetD32			(VEDAdeviceptr dstDevice, uint32_t ui, size_t N);
+VEDAresult	vedaMemsetD3D8			(VEDAdeviceptr dstDevice, size_t dstPitch, size_t dstSlicePitch, uint8_t uc, size_t Width, size_t Height, size_t Depth);
+VEDAresult	vedaMemsetD3D8Async		(VEDAdeviceptr dstDevice, size_t dstPitch, size_t dstSlicePitch, uint8_t uc, size_t Width, size_t Height, size_t Depth, VEDAstream hStream);
 VEDAresult	vedaMemsetD32Async		(VEDAdeviceptr dstDevice, uint32_t ui, size_t N, VEDAstream hStream);
 VEDAresult	vedaMemsetD64			(VEDAdeviceptr dstDevice, uint64_t ui, size_t N);
 VEDAresult	vedaMemsetD64Async		(VEDAdeviceptr dstDevice, uint64_t ui, size_t N, VEDAstream hStream);
@@ -128,7 +145,13 @@ VEDAresult	vedaMemsetD8Async		(VEDAdeviceptr dstDevice, uint8_t uc, size_t N, VE
 VEDAresult	vedaModuleGetFunction		(VEDAfunction* hfunc, VEDAmodule hmod, const char* name);
 VEDAresult	vedaModuleLoad			(VEDAmodule* module, const char* fname);
 VEDAresult	vedaModuleUnload		(VEDAmodule hmod);
+VEDAresult	vedaScan			(VEDAdeviceptr dst, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, int inclusive);
+VEDAresult	vedaScanAsync			(VEDAdeviceptr dst, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, int inclusive, VEDAstream hStream);
+VEDAresult	vedaSort			(VEDAdeviceptr keys, VEDAdeviceptr values, size_t cnt, VEDAdtype dtype);
+VEDAresult	vedaSortAsync			(VEDAdeviceptr keys, VEDAdeviceptr values, size_t cnt, VEDAdtype dtype, VEDAstream hStream);
 VEDAresult	vedaStreamAddCallback		(VEDAstream stream, VEDAstream_callback callback, void* userData, unsigned int flags);
+VEDAresult	vedaStreamDisablePersistent	(VEDAstream stream);
+VEDAresult	vedaStreamEnablePersistent	(VEDAstream stream);
 VEDAresult	vedaStreamGetFlags		(VEDAstream hStream, uint32_t* flags);
 VEDAresult	vedaStreamQuery			(VEDAstream hStream);
 VEDAresult	vedaStreamSynchronize		(VEDAstream hStream);
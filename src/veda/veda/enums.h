@@ -76,13 +76,58 @@ enum VEDAargs_intent_enum {
 	VEDA_ARGS_INTENT_OUT	= 2
 };
 
+enum VEDAinit_flags_enum {
+	VEDA_INIT_PREWARM	= 1
+};
+
 enum VEDAcontext_mode_enum {
 	VEDA_CONTEXT_MODE_OMP		= 0,
 	VEDA_CONTEXT_MODE_SCALAR	= 1
 };
 
+enum VEDAmemop_type_enum {
+	VEDA_MEMOP_MEMCPY	= 0,
+	VEDA_MEMOP_MEMSET_U8	= 1,
+	VEDA_MEMOP_MEMSET_U16	= 2,
+	VEDA_MEMOP_MEMSET_U32	= 3,
+	VEDA_MEMOP_MEMSET_U64	= 4
+};
+
+enum VEDAlimit_enum {
+	VEDA_LIMIT_OMP_MEMSET_D8	= 0,
+	VEDA_LIMIT_OMP_MEMSET_D64	= 1,
+	VEDA_LIMIT_OMP_MEMSET_D128	= 2,
+	VEDA_LIMIT_OMP_MEMCPY		= 3,
+	VEDA_LIMIT_OMP_MEMOPS		= 4,
+	VEDA_LIMIT_NONTEMPORAL		= 5,
+	VEDA_LIMIT_TEAM			= 6,
+	VEDA_LIMIT_SCRATCH		= 7,
+	VEDA_LIMIT_CNT
+};
+
+enum VEDAmem_placement_enum {
+	VEDA_MEM_PLACEMENT_DEFAULT	= 0,
+	VEDA_MEM_PLACEMENT_LOCAL	= 1,
+	VEDA_MEM_PLACEMENT_INTERLEAVED	= 2,
+	VEDA_MEM_PLACEMENT_NODE		= 3
+};
+
+enum VEDAdtype_enum {
+	VEDA_DTYPE_INT32	= 0,
+	VEDA_DTYPE_INT64	= 1,
+	VEDA_DTYPE_UINT32	= 2,
+	VEDA_DTYPE_UINT64	= 3,
+	VEDA_DTYPE_FLOAT	= 4,
+	VEDA_DTYPE_DOUBLE	= 5
+};
+
 typedef enum VEDAresult_enum		VEDAresult;
 typedef enum VEDAdevice_attribute_enum	VEDAdevice_attribute;
 typedef enum VEDAargs_intent_enum	VEDAargs_intent;
 typedef enum VEDAcontext_mode_enum	VEDAcontext_mode;
+typedef enum VEDAinit_flags_enum	VEDAinit_flags;
+typedef enum VEDAmemop_type_enum	VEDAmemop_type;
+typedef enum VEDAlimit_enum		VEDAlimit;
+typedef enum VEDAdtype_enum		VEDAdtype;
+typedef enum VEDAmem_placement_enum	VEDAmem_placement;
 
@@ -15,13 +15,19 @@ typedef uint64_t veo_lib;
 #include <set>
 #include <sstream>
 #include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 #include <deque>
 #include <atomic>
 #include <thread>
 #include <chrono>
 #include <functional>
+#include <future>
+#include <condition_variable>
 #include <dlfcn.h>
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
 
 #define L_MODULE "VEDA"
 #include <tungl/c.h>
@@ -35,24 +41,31 @@ namespace veda {
 	class Device;
 	class NUMA;
 	struct Stream;
+	struct PackedArgs;
 }
 
 #include "internal_macros.h"
 #include "Semaphore.h"
+#include "Trace.h"
 #include "Kernel.h"
 #include "Module.h"
 #include "Context.h"
 #include "Contexts.h"
+#include "Telemetry.h"
 #include "Device.h"
 #include "Devices.h"
 #include "Stream.h"
+#include "Accounting.h"
 
 //------------------------------------------------------------------------------
 namespace veda {
 	const char*	stdLib		(void);
 	int		ompThreads	(void);
+	uint64_t	telemetryTTL	(void);
 	bool		isMemTrace	(void);
+	bool		isTuneLimits	(void);
 	VEDAresult	VEOtoVEDA	(const int err);
+	const PackedArgs* packedArgs	(VEDAargs args);
 	void		checkInitialized(void);
 	void		setInitialized	(const bool value);
 inline	void		checkContext	(VEDAcontext ctx)	{	if(dynamic_cast<VEDAcontext>(ctx) == 0)	VEDA_THROW(VEDA_ERROR_INVALID_CONTEXT);	}
@@ -28,7 +28,7 @@ inline void veda_throw [[noreturn]] (VEDAresult err, const char* file, const int
 	return VEDA_SUCCESS;
 
 #define GUARDED(...)\
-	veda::Guard __guard;\
+	veda::Guard __guard(__func__);\
 	TRY(__VA_ARGS__)
 
 #define CREQ(REQ)	({ uint64_t _r = REQ; if(_r == VEO_REQUEST_ID_INVALID) VEDA_THROW(VEDA_ERROR_INVALID_REQID); _r; })
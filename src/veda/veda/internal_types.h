@@ -2,6 +2,8 @@
 
 #include <stdint.h>
 
+#define VEDA_LIMIT_DEFAULT	(2 * 1024 * 1024)
+
 typedef struct VEDAdeviceptrInfo_struct {
 	void*	ptr;
 	size_t	size;
@@ -20,3 +22,75 @@ typedef struct VEDAdeviceptrInfo_struct {
 } VEDAdeviceptrInfo;
 
 static_assert(sizeof(VEDAdeviceptrInfo) == 16);
+
+//------------------------------------------------------------------------------
+/** Header of a notification channel, followed by capacity slots of
+ * VEDA_CHANNEL_SLOT(recordSize) bytes. Each slot starts with a sequence number
+ * that the device sets to pos + 1 after the record at position pos is written.
+ * head is only written by the device, tail only by the host, both are kept in
+ * separate cache lines. */
+typedef struct VEDAchannelHeader_struct {
+	uint64_t	head;		// next position to reserve
+	uint64_t	_pad0[15];
+	uint64_t	tail;		// next position to consume
+	uint64_t	capacity;	// number of slots, power of 2
+	uint64_t	recordSize;	// bytes per record
+	uint64_t	_pad1[13];
+} VEDAchannelHeader;
+
+static_assert(sizeof(VEDAchannelHeader) == 256);
+
+#define VEDA_CHANNEL_SLOT(recordSize)	(sizeof(uint64_t) + (((recordSize) + 7) & ~size_t(7)))
+
+//------------------------------------------------------------------------------
+#define VEDA_PERSISTENT_ARGS		8	// arguments passed in registers
+#define VEDA_PERSISTENT_CAPACITY	256	// commands per ring, power of 2
+#define VEDA_PERSISTENT_COUNTERS	4	// device counters per command
+
+/** Command in the ring of a persistent stream. The host writes func and args
+ * and then sets seq to pos + 1. The device sets done to pos + 1 after storing
+ * the return value of func in result. func == 0 stops the persistent loop. If
+ * the loop runs with profiling enabled, counters contains the clock cycles
+ * and the PMC00-PMC02 counts of func, see veda_persistent. */
+typedef struct VEDAcommand_struct {
+	uint64_t	seq;
+	uint64_t	func;
+	uint64_t	args[VEDA_PERSISTENT_ARGS];
+	uint64_t	done;
+	uint64_t	result;
+	uint64_t	counters[VEDA_PERSISTENT_COUNTERS];
+} VEDAcommand;
+
+static_assert(sizeof(VEDAcommand) == 128);
+
+
+//------------------------------------------------------------------------------
+#define VEDA_ACCOUNTING_MAGIC	0x5443434144455600ull	// "\0VEDACCT"
+#define VEDA_ACCOUNTING_DEVICES	32
+
+/** Live statistics of the context of one device, see veda::Accounting. All
+ * counters are updated with atomics, so they can be read at any time by other
+ * processes. busyTime accumulates the run time of the completed application
+ * kernels in ns. */
+typedef struct VEDAaccountingDevice_struct {
+	int32_t		sensorId;
+	int32_t		numaId;
+	int32_t		active;
+	int32_t		streams;
+	uint64_t	memUsed;
+	uint64_t	allocations;
+	uint64_t	kernelsInFlight;
+	uint64_t	kernelsLaunched;
+	uint64_t	busyTime;
+	uint64_t	_pad;
+} VEDAaccountingDevice;
+
+static_assert(sizeof(VEDAaccountingDevice) == 64);
+
+/** Content of the shared memory segment /dev/shm/veda.<pid>. */
+typedef struct VEDAaccountingProcess_struct {
+	uint64_t		magic;
+	int32_t			pid;
+	int32_t			_pad;
+	VEDAaccountingDevice	devices[VEDA_ACCOUNTING_DEVICES];
+} VEDAaccountingProcess;
\ No newline at end of file
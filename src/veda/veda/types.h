@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stddef.h>
 #include "enums.h"
 #include "macros.h"
 
@@ -22,6 +23,52 @@ typedef struct {
 
 typedef VEDAdeviceptr_* VEDAdeviceptr;
 
+/** Descriptor of a single fill or copy operation, used by vedaMemOpsAsync.
+ * For VEDA_MEMOP_MEMCPY cnt is given in bytes and value is ignored, for
+ * VEDA_MEMOP_MEMSET_* cnt is the number of elements and src is ignored. */
+typedef struct {
+	VEDAmemop_type	type;
+	VEDAdeviceptr	dst;
+	VEDAdeviceptr	src;
+	uint64_t	value;
+	size_t		cnt;
+} VEDAmemop;
+
+#if __cplusplus
+static_assert(sizeof(VEDAmemop) == 40, "VEDAmemop needs to have the same layout on VH and VE");
+#endif
+
+/** Maximum number of cores reported by VEDAtelemetry. */
+#define VEDA_TELEMETRY_MAX_CORES 32
+
+/** Snapshot of all sensors of a device, filled by vedaDeviceGetTelemetry.
+ * coreTemp contains cores valid entries in Celsius. timestamp is the
+ * CLOCK_MONOTONIC time in ns at which the sensors have been read. */
+typedef struct {
+	uint64_t	timestamp;
+	float		power;
+	float		current;
+	float		currentEdge;
+	float		voltage;
+	float		voltageEdge;
+	int		cores;
+	float		coreTemp[VEDA_TELEMETRY_MAX_CORES];
+} VEDAtelemetry;
+
+/** Resources held by one process on a device, filled by
+ * vedaDeviceGetProcesses. Only kernels launched with vedaLaunchKernel* are
+ * counted. busyTime is the cumulative time in ns these kernels ran, see
+ * veda::Accounting::completed. */
+typedef struct {
+	int		pid;
+	int		streams;
+	uint64_t	memUsed;
+	uint64_t	allocations;
+	uint64_t	kernelsInFlight;
+	uint64_t	kernelsLaunched;
+	uint64_t	busyTime;
+} VEDAprocessUsage;
+
 #if __cplusplus
 	template<typename T = char>
 	class VEDAptr {
@@ -57,6 +104,7 @@ typedef VEDAdeviceptr_* VEDAdeviceptr;
 		inline	Ref		operator*		(void) const					{	return {m_ptr};							}
 		inline	Ref		operator[]		(const size_t offset) const			{	return m_ptr + offset * sizeof(T);				}
 		inline	VEDAdevice	device			(void) const					{	return VEDA_GET_DEVICE(m_ptr);					}
+		inline	int		ctx			(void) const					{	return VEDA_GET_CTX(m_ptr);					}
 		inline	VEDAidx		idx			(void) const					{	return VEDA_GET_IDX(m_ptr);					}
 		inline	VEDAptr<T>	base			(void) const					{	return (VEDAdeviceptr)((uint64_t)m_ptr & ~VEDA_BITS_OFFSET);	}
 		inline	VEDAptr<T>	operator+		(const size_t offset) const			{	return m_ptr + offset * sizeof(T);				}
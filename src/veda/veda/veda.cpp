@@ -4,13 +4,17 @@ namespace veda {
 //------------------------------------------------------------------------------
 static bool		s_initialized	= false;
 static bool		s_memTrace	= false;
+static bool		s_tuneLimits	= false;
 static int		s_ompThreads	= 0;
+static uint64_t		s_telemetryTTL	= 100;
 static std::string	s_stdLib;
 
 //------------------------------------------------------------------------------
 bool		isMemTrace	(void) {	return s_memTrace;						}
+bool		isTuneLimits	(void) {	return s_tuneLimits;						}
 const char*	stdLib		(void) {	return s_stdLib.c_str();					}
 int		ompThreads	(void) {	return s_ompThreads;						}
+uint64_t	telemetryTTL	(void) {	return s_telemetryTTL;						}
 void		checkInitialized(void) {	if(!s_initialized) VEDA_THROW(VEDA_ERROR_NOT_INITIALIZED);	}
 
 //------------------------------------------------------------------------------
@@ -25,6 +29,15 @@ void setInitialized(const bool value) {
 		auto memTrace = std::getenv("VEDA_MEM_TRACE");
 		s_memTrace = memTrace && std::atoi(memTrace);
 
+		// Init TuneLimits ---------------------------------------------
+		auto tuneLimits = std::getenv("VEDA_TUNE_LIMITS");
+		s_tuneLimits = tuneLimits && std::atoi(tuneLimits);
+
+		// Init Telemetry TTL -----------------------------------------
+		auto telemetryTTL = std::getenv("VEDA_TELEMETRY_TTL");
+		if(telemetryTTL)
+			s_telemetryTTL = std::strtoull(telemetryTTL, 0, 10);
+
 		// Init OMP Threads --------------------------------------------
 		auto env = std::getenv("VE_OMP_NUM_THREADS");
 		if(env)
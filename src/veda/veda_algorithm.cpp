@@ -0,0 +1,211 @@
+#include "veda/internal.h"
+
+extern "C" {
+// implementation of VEDA API functions
+/**
+ * \defgroup vedaapi VEDA API
+ *
+ * To use VEDA API functions, include "veda.h" header.
+ */
+/** @{ */
+//------------------------------------------------------------------------------
+/**
+ * @brief Computes the prefix sum of a device buffer.
+ * @param dst Destination device pointer.
+ * @param src Source device pointer, can be the same as dst.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements.
+ * @param inclusive If non-zero, dst[i] includes src[i], otherwise the scan is exclusive.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE dst or src is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE dst and src belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of dst or src.
+ *
+ * See vedaScanAsync.
+ */
+VEDAresult vedaScan(VEDAdeviceptr dst, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, int inclusive) {
+	CVEDA(vedaScanAsync(dst, src, cnt, dtype, inclusive, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Computes the prefix sum of a device buffer asynchronously.
+ * @param dst Destination device pointer.
+ * @param src Source device pointer, can be the same as dst.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements.
+ * @param inclusive If non-zero, dst[i] includes src[i], otherwise the scan is exclusive.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE dst or src is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE dst and src belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of dst or src.
+ *
+ * Executes veda_omp_scan_inclusive or veda_omp_scan_exclusive of
+ * veda_device_omp.h on the device.
+ */
+VEDAresult vedaScanAsync(VEDAdeviceptr dst, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, int inclusive, VEDAstream hStream) {
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(dst);
+		L_TRACE("[ve:%i] vedaScanAsync(%p, %p, %llu, %i, %i, %i)", ctx.device().vedaId(), dst, src, cnt, dtype, inclusive, hStream);
+		ctx.scan(dst, src, cnt, dtype, inclusive != 0, hStream);
+	)
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Sorts a device buffer.
+ * @param keys Device pointer to the keys, which get sorted in place.
+ * @param values Optional device pointer to uint64_t values, or NULL.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the keys.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE keys is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE keys and values belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of keys or values.
+ *
+ * See vedaSortAsync.
+ */
+VEDAresult vedaSort(VEDAdeviceptr keys, VEDAdeviceptr values, size_t cnt, VEDAdtype dtype) {
+	CVEDA(vedaSortAsync(keys, values, cnt, dtype, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Sorts a device buffer asynchronously.
+ * @param keys Device pointer to the keys, which get sorted in place.
+ * @param values Optional device pointer to uint64_t values, or NULL.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the keys.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE keys is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE keys and values belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of keys or values.
+ *
+ * Sorts the keys ascending with a stable radix sort. If values is not NULL,
+ * the same permutation gets applied to values, e.g. to obtain the indices of
+ * the sorted keys.
+ */
+VEDAresult vedaSortAsync(VEDAdeviceptr keys, VEDAdeviceptr values, size_t cnt, VEDAdtype dtype, VEDAstream hStream) {
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(keys);
+		L_TRACE("[ve:%i] vedaSortAsync(%p, %p, %llu, %i, %i)", ctx.device().vedaId(), keys, values, cnt, dtype, hStream);
+		ctx.sort(keys, values, cnt, dtype, hStream);
+	)
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Copies all masked elements of a device buffer.
+ * @param dst Destination device pointer, must not overlap with src.
+ * @param src Source device pointer.
+ * @param mask Device pointer to cnt uint8_t flags.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements.
+ * @param pcnt Device pointer to a uint64_t, that receives the number of copied elements.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE dst, src, mask or pcnt is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE The pointers belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of a buffer.
+ *
+ * See vedaCompactAsync.
+ */
+VEDAresult vedaCompact(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, size_t cnt, VEDAdtype dtype, VEDAdeviceptr pcnt) {
+	CVEDA(vedaCompactAsync(dst, src, mask, cnt, dtype, pcnt, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Copies all masked elements of a device buffer asynchronously.
+ * @param dst Destination device pointer, must not overlap with src.
+ * @param src Source device pointer.
+ * @param mask Device pointer to cnt uint8_t flags.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements.
+ * @param pcnt Device pointer to a uint64_t, that receives the number of copied elements.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE dst, src, mask or pcnt is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not a valid VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE The pointers belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS cnt exceeds the size of a buffer.
+ *
+ * Copies all src[i] with mask[i] != 0 to the beginning of dst, keeping their
+ * order. The number of copied elements stays on the device, so it can be
+ * consumed by subsequent kernels without synchronizing.
+ */
+VEDAresult vedaCompactAsync(VEDAdeviceptr dst, VEDAdeviceptr src, VEDAdeviceptr mask, size_t cnt, VEDAdtype dtype, VEDAdeviceptr pcnt, VEDAstream hStream) {
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(dst);
+		L_TRACE("[ve:%i] vedaCompactAsync(%p, %p, %p, %llu, %i, %p, %i)", ctx.device().vedaId(), dst, src, mask, cnt, dtype, pcnt, hStream);
+		ctx.compact(dst, src, mask, cnt, dtype, pcnt, hStream);
+	)
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Computes the histogram of a device buffer.
+ * @param bins Device pointer to nbins uint64_t counters.
+ * @param nbins Number of bins.
+ * @param src Source device pointer.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements, needs to be an integer type.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE bins or src is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not an integer VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE bins and src belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS nbins or cnt exceed the size of bins or src.
+ *
+ * See vedaHistogramAsync.
+ */
+VEDAresult vedaHistogram(VEDAdeviceptr bins, size_t nbins, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype) {
+	CVEDA(vedaHistogramAsync(bins, nbins, src, cnt, dtype, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Computes the histogram of a device buffer asynchronously.
+ * @param bins Device pointer to nbins uint64_t counters.
+ * @param nbins Number of bins.
+ * @param src Source device pointer.
+ * @param cnt Number of elements.
+ * @param dtype Data type of the elements, needs to be an integer type.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE bins or src is NULL.
+ * @retval VEDA_ERROR_INVALID_DTYPE dtype is not an integer VEDAdtype.
+ * @retval VEDA_ERROR_INVALID_DEVICE bins and src belong to different devices.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS nbins or cnt exceed the size of bins or src.
+ *
+ * Sets bins[v] to the number of occurrences of v in src, for all v in
+ * [0, nbins). Values outside of this range are ignored.
+ */
+VEDAresult vedaHistogramAsync(VEDAdeviceptr bins, size_t nbins, VEDAdeviceptr src, size_t cnt, VEDAdtype dtype, VEDAstream hStream) {
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(bins);
+		L_TRACE("[ve:%i] vedaHistogramAsync(%p, %llu, %p, %llu, %i, %i)", ctx.device().vedaId(), bins, nbins, src, cnt, dtype, hStream);
+		ctx.histogram(bins, nbins, src, cnt, dtype, hStream);
+	)
+}
+
+//------------------------------------------------------------------------------
+/** @} */
+} // extern "C"
@@ -1,5 +1,47 @@
 #include "veda/internal.h"
 
+//------------------------------------------------------------------------------
+// Packed Arguments
+//------------------------------------------------------------------------------
+/** Register values of the VEDAargs that this thread created last. Persistent
+ * streams use them to launch kernels without AVEO. Building multiple VEDAargs
+ * interleaved in the same thread falls back to AVEO for all but the last. */
+static thread_local veda::PackedArgs s_packed(0);
+
+//------------------------------------------------------------------------------
+static inline void vedaArgsPack(VEDAargs args, const int idx, const uint64_t value) {
+	if(s_packed.args != args)
+		return;
+	if(idx < 0 || idx >= VEDA_PERSISTENT_ARGS) {
+		s_packed.valid = false;
+		return;
+	}
+	s_packed.regs[idx]	= value;
+	s_packed.cnt		= std::max(s_packed.cnt, idx + 1);
+}
+
+//------------------------------------------------------------------------------
+/** VE passes float arguments in the upper 32 bits of the scalar register. */
+static inline uint64_t vedaArgsFloatReg(const float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return uint64_t(bits) << 32;
+}
+
+//------------------------------------------------------------------------------
+static inline uint64_t vedaArgsDoubleReg(const double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+//------------------------------------------------------------------------------
+namespace veda {
+	const PackedArgs* packedArgs(VEDAargs args) {
+		return s_packed.args == args && s_packed.valid ? &s_packed : 0;
+	}
+}
+
 extern "C" {
 // implementation of VEDA API functions
 /**
@@ -19,6 +61,8 @@ extern "C" {
  */
 VEDAresult vedaArgsCreate(VEDAargs* args) {
 	*args = veo_args_alloc();
+	if(*args)
+		s_packed = veda::PackedArgs(*args);
 	return *args ? VEDA_SUCCESS : VEDA_ERROR_OUT_OF_MEMORY;
 }
 
@@ -32,6 +76,8 @@ VEDAresult vedaArgsCreate(VEDAargs* args) {
 VEDAresult vedaArgsDestroy(VEDAargs args) {
 	if(!args)
 		return VEDA_ERROR_INVALID_ARGS;
+	if(s_packed.args == args)
+		s_packed = veda::PackedArgs(0);
 	veo_args_free(args);
 	return VEDA_SUCCESS;
 }
@@ -49,6 +95,7 @@ VEDAresult vedaArgsDestroy(VEDAargs args) {
 VEDAresult vedaArgsSetI8(VEDAargs args, const int idx, const int8_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_i8(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(int64_t(value)));
 	return VEDA_SUCCESS;
 }
 
@@ -65,6 +112,7 @@ VEDAresult vedaArgsSetI8(VEDAargs args, const int idx, const int8_t value) {
 VEDAresult vedaArgsSetI16(VEDAargs args, const int idx, const int16_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_i16(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(int64_t(value)));
 	return VEDA_SUCCESS;
 }
 
@@ -81,6 +129,7 @@ VEDAresult vedaArgsSetI16(VEDAargs args, const int idx, const int16_t value) {
 VEDAresult vedaArgsSetI32(VEDAargs args, const int idx, const int32_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_i32(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(int64_t(value)));
 	return VEDA_SUCCESS;
 }
 
@@ -97,6 +146,7 @@ VEDAresult vedaArgsSetI32(VEDAargs args, const int idx, const int32_t value) {
 VEDAresult vedaArgsSetI64(VEDAargs args, const int idx, const int64_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_i64(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(value));
 	return VEDA_SUCCESS;
 }
 
@@ -113,6 +163,7 @@ VEDAresult vedaArgsSetI64(VEDAargs args, const int idx, const int64_t value) {
 VEDAresult vedaArgsSetU8(VEDAargs args, const int idx, const uint8_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_u8(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(value));
 	return VEDA_SUCCESS;
 }
 
@@ -129,6 +180,7 @@ VEDAresult vedaArgsSetU8(VEDAargs args, const int idx, const uint8_t value) {
 VEDAresult vedaArgsSetU16(VEDAargs args, const int idx, const uint16_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_u16(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(value));
 	return VEDA_SUCCESS;
 }
 
@@ -145,6 +197,7 @@ VEDAresult vedaArgsSetU16(VEDAargs args, const int idx, const uint16_t value) {
 VEDAresult vedaArgsSetU32(VEDAargs args, const int idx, const uint32_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_u32(args, idx, value));
+	vedaArgsPack(args, idx, uint64_t(value));
 	return VEDA_SUCCESS;
 }
 
@@ -161,6 +214,7 @@ VEDAresult vedaArgsSetU32(VEDAargs args, const int idx, const uint32_t value) {
 VEDAresult vedaArgsSetU64(VEDAargs args, const int idx, const uint64_t value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_u64(args, idx, value));
+	vedaArgsPack(args, idx, value);
 	return VEDA_SUCCESS;
 }
 
@@ -180,6 +234,7 @@ VEDAresult vedaArgsSetHMEM(VEDAargs args, const int idx, const void* value) {
 	if(!args)			return VEDA_ERROR_INVALID_ARGS;
 	if(!veo_is_ve_addr(value))	return VEDA_ERROR_INVALID_VALUE;
 	CVEO(veo_args_set_u64(args, idx, (uint64_t)veo_get_hmem_addr((void*)value)));
+	vedaArgsPack(args, idx, (uint64_t)veo_get_hmem_addr((void*)value));
 	return VEDA_SUCCESS;
 }
 
@@ -198,6 +253,7 @@ VEDAresult vedaArgsSetHMEM(VEDAargs args, const int idx, const void* value) {
 VEDAresult vedaArgsSetPtr(VEDAargs args, const int idx, const VEDAdeviceptr value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_u64(args, idx, (uint64_t)VEDAptr<>(value).ptr()));
+	vedaArgsPack(args, idx, (uint64_t)VEDAptr<>(value).ptr());
 	return VEDA_SUCCESS;
 }
 
@@ -230,6 +286,7 @@ VEDAresult vedaArgsSetVPtr(VEDAargs args, const int idx, const VEDAdeviceptr val
 VEDAresult vedaArgsSetF32(VEDAargs args, const int idx, const float value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_float(args, idx, value));
+	vedaArgsPack(args, idx, vedaArgsFloatReg(value));
 	return VEDA_SUCCESS;
 }
 
@@ -246,6 +303,7 @@ VEDAresult vedaArgsSetF32(VEDAargs args, const int idx, const float value) {
 VEDAresult vedaArgsSetF64(VEDAargs args, const int idx, const double value) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_double(args, idx, value));
+	vedaArgsPack(args, idx, vedaArgsDoubleReg(value));
 	return VEDA_SUCCESS;
 }
 
@@ -269,6 +327,7 @@ VEDAresult vedaArgsSetF64(VEDAargs args, const int idx, const double value) {
 VEDAresult vedaArgsSetStack(VEDAargs args, const int idx, void* ptr, VEDAargs_intent intent, const size_t size) {
 	if(!args)	return VEDA_ERROR_INVALID_ARGS;
 	CVEO(veo_args_set_stack(args, (veo_args_intent)intent, idx, (char*)ptr, size));
+	vedaArgsPack(args, -1, 0); // stack arguments can't be packed
 	return VEDA_SUCCESS;
 }
 /** @} */
@@ -0,0 +1,74 @@
+#include "veda/internal.h"
+
+extern "C" {
+// implementation of VEDA API functions
+/**
+ * \defgroup vedaapi VEDA API
+ *
+ * To use VEDA API functions, include "veda.h" header.
+ */
+/** @{ */
+//------------------------------------------------------------------------------
+/**
+ * @brief Creates a notification channel, that device code can write records
+ * to while the host polls them.
+ * @param channel Returned VEDA device pointer of the channel.
+ * @param recordSize Size of each record in bytes.
+ * @param capacity Number of records the channel can buffer, gets rounded up to
+ * the next power of 2.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE recordSize or capacity is 0 or the channel would exceed the address space.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.
+ * @retval VEDA_ERROR_OUT_OF_MEMORY VEDA device memory exausted.\n 
+ *
+ * Pass the channel to a kernel and call vedaChannelPush or vedaChannelTryPush
+ * of veda_device.h with the VEDAptr<>::ptr() of the channel to send progress
+ * counters or partial results to the host without ending the kernel. The
+ * host receives them using vedaChannelPoll. Multiple device threads can push
+ * to the same channel. Free the channel with vedaMemFree.
+ */
+VEDAresult vedaChannelCreate(VEDAdeviceptr* channel, size_t recordSize, size_t capacity) {
+	GUARDED(
+		if(!channel)
+			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+		auto ctx = veda::Contexts::current();
+		*channel = ctx->channelCreate(recordSize, capacity);
+		L_TRACE("[ve:%i] vedaChannelCreate(%p, %llu, %llu)", ctx->device().vedaId(), *channel, recordSize, capacity);
+	)
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Receives the records that device code has pushed to a notification
+ * channel.
+ * @param channel VEDA device pointer of the channel.
+ * @param records Host buffer for at least maxRecords records.
+ * @param maxRecords Maximum number of records to receive.
+ * @param cnt Returns the number of received records.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE channel, records or cnt is NULL.
+ * @retval VEDA_ERROR_OFFSET_NOT_ALLOWED channel is offsetted.
+ * @retval VEDA_ERROR_UNKNOWN_VPTR channel is not a valid VEDA device pointer.\n 
+ *
+ * Does not block and does not use any stream, so it can be called while the
+ * kernel that pushes the records is still running. Records are received in the
+ * order the device reserved them. Reading the channel goes through the HMEM
+ * mapping of the device memory, so polling an empty channel costs a single
+ * PCIe read.
+ */
+VEDAresult vedaChannelPoll(VEDAdeviceptr channel, void* records, size_t maxRecords, size_t* cnt) {
+	GUARDED(
+		if(!cnt)
+			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+		auto& ctx	= veda::Devices::ctx(channel);
+		*cnt		= ctx.channelPoll(channel, records, maxRecords);
+		L_TRACE("[ve:%i] vedaChannelPoll(%p, %p, %llu, %llu)", ctx.device().vedaId(), channel, records, maxRecords, *cnt);
+	)
+}
+
+//------------------------------------------------------------------------------
+/** @} */
+} // extern "C"
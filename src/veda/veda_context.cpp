@@ -99,6 +99,28 @@ VEDAresult vedaCtxGetDevice(VEDAdevice* device) {
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Returns resource limits.
+ * @param pvalue Returned size of the limit.
+ * @param limit Limit to query.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE limit is not a valid VEDAlimit.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Returns in *pvalue the current size of limit. See vedaCtxSetLimit for the
+ * supported limits.
+ */
+VEDAresult vedaCtxGetLimit(size_t* pvalue, VEDAlimit limit) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		*pvalue = ctx->getLimit(limit);
+		L_TRACE("[ve:%i] vedaCtxGetLimit(%llu, %i)", ctx->device().vedaId(), *pvalue, limit);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Pops the current VEDA context from the current CPU thread.
@@ -173,6 +195,51 @@ VEDAresult vedaCtxSetCurrent(VEDAcontext ctx) {
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Set resource limits.
+ * @param limit Limit to set.
+ * @param value Size of limit.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE limit is not a valid VEDAlimit.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Setting limit to value is a request by the application to update the current
+ * limit maintained by the context. Supported limits are:\n 
+ * VEDA_LIMIT_OMP_MEMSET_D8: Size in bytes from which vedaMemsetD8 uses all
+ * OpenMP threads of the device.\n 
+ * VEDA_LIMIT_OMP_MEMSET_D64: Size in bytes from which vedaMemsetD16,
+ * vedaMemsetD32 and vedaMemsetD64 use all OpenMP threads of the device.\n 
+ * VEDA_LIMIT_OMP_MEMSET_D128: Size in bytes from which vedaMemsetD128 uses all
+ * OpenMP threads of the device.\n 
+ * VEDA_LIMIT_OMP_MEMCPY: Size in bytes from which device to device copies use
+ * all OpenMP threads of the device.\n 
+ * VEDA_LIMIT_OMP_MEMOPS: Total size in bytes from which vedaMemOpsAsync uses
+ * all OpenMP threads of the device.\n 
+ * VEDA_LIMIT_NONTEMPORAL: Size in bytes from which vedaMemsetD8, vedaMemsetD16,
+ * vedaMemsetD32, vedaMemsetD64 and device to device copies use non-temporal
+ * stores that bypass the last level cache. Defaults to the LLC size of the
+ * device. Set to 0 to always or to SIZE_MAX to never use non-temporal
+ * stores.\n 
+ * VEDA_LIMIT_TEAM: Size in bytes below which vedaMemsetD8, vedaMemsetD16,
+ * vedaMemsetD32, vedaMemsetD64, vedaMemsetD128 and device to device copies
+ * run on a persistent team of spinning worker threads, instead of running
+ * serially or opening an OpenMP region. vedaMemOpsAsync and 2D/3D memsets
+ * never use the team. Defaults to 0 (disabled).\n 
+ * VEDA_LIMIT_SCRATCH: Size in bytes of the scratch arena that each VE thread
+ * allocates on its first call to vedaScratchAlloc. Defaults to 16MB. Changes
+ * apply to arenas without outstanding allocations.
+ */
+VEDAresult vedaCtxSetLimit(VEDAlimit limit, size_t value) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		L_TRACE("[ve:%i] vedaCtxSetLimit(%i, %llu)", ctx->device().vedaId(), limit, value);
+		ctx->setLimit(limit, value);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Gets the VEDA SM count.
@@ -213,6 +280,31 @@ VEDAresult vedaCtxSynchronize(void) {
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Calibrates the parallelization limits of the current context.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_OUT_OF_MEMORY Not enough device memory for calibration.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Measures on the device at which sizes the multi-threaded implementations of
+ * memset and memcpy become faster than the single-threaded ones, and sets the
+ * VEDA_LIMIT_OMP_* limits accordingly. If the multi-threaded version is not
+ * faster for any measured size, the limit gets set to the largest measured
+ * size of 64MB and a warning gets logged. This blocks until the calibration is
+ * finished. Setting the env var VEDA_TUNE_LIMITS=1 calls this automatically
+ * when a context in VEDA_CONTEXT_MODE_OMP gets created.
+ */
+VEDAresult vedaCtxTuneLimits(void) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		L_TRACE("[ve:%i] vedaCtxTuneLimits()", ctx->device().vedaId());
+		ctx->tuneLimits();
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Create a VEDA context.
@@ -246,9 +338,8 @@ VEDAresult vedaCtxSynchronize(void) {
  */
 VEDAresult vedaCtxCreate(VEDAcontext* pctx, int mode, VEDAdevice dev) {
 	GUARDED(
-		*pctx = &veda::Devices::get(dev).ctx();
+		*pctx = &veda::Devices::get(dev).ctxCreate((VEDAcontext_mode)mode);
 		L_TRACE("[ve:%i] vedaCtxCreate(%p, %i, %i)", dev, *pctx, mode, dev);
-		(*pctx)->init((VEDAcontext_mode)mode);
 		veda::Contexts::push(*pctx);
 	)
 }
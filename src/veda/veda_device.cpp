@@ -73,6 +73,32 @@ VEDAresult vedaDeviceGetTemp(float* tempC, const int coreIdx, VEDAdevice dev) {
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Retrieve a snapshot of all power and temperature sensors of the VEDA
+ * device.
+ * @param telemetry pointer to hold the sensor values.
+ * @param dev VEDA device ID.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_INVALID_VALUE telemetry is a nullptr.
+ * @retval VEDA_ERROR_CANT_READ_SENSOR_FILE a sensor could not be read.\n
+ *
+ * All sensors of a device get read in one pass through permanently opened
+ * sysfs files. The snapshot is cached for VEDA_TELEMETRY_TTL milliseconds
+ * (default: 100), which also applies to vedaDeviceGetTemp, vedaDeviceGetPower
+ * and the other sensor functions.
+ */
+VEDAresult vedaDeviceGetTelemetry(VEDAtelemetry* telemetry, VEDAdevice dev) {
+	GUARDED(
+		if(!telemetry)
+			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+		*telemetry = veda::Devices::get(dev).telemetry();
+		L_TRACE("[ve:%i] vedaDeviceGetTelemetry(%p, %i)", dev, telemetry, dev);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Retrieve the number of initialized VEDA device.
@@ -229,12 +255,37 @@ VEDAresult vedaDeviceGet(VEDAdevice* device, int ordinal) {
  */
 VEDAresult vedaDeviceGetPower(float* watts, VEDAdevice dev) {
 	GUARDED(
-		auto& device = veda::Devices::get(dev);
-		*watts = ((device.powerVoltage() * device.powerCurrent())+(device.powerVoltageEdge() * device.powerCurrentEdge())+5.0);
+		*watts = veda::Devices::get(dev).telemetry().power;
 		L_TRACE("[ve:%i] vedaDeviceGetPower(%f, %i)", dev, *watts, dev);
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Retrieve the resources used by all processes that have an active
+ * VEDA context on the VEDA device.
+ * @param usage array to hold the usage of up to *cnt processes, can be a
+ * nullptr if *cnt is 0.
+ * @param cnt in: size of usage, out: number of processes using the device.
+ * @param dev VEDA device ID.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_INVALID_VALUE cnt is a nullptr or negative.\n
+ *
+ * Every process publishes the statistics of its contexts in the shared memory
+ * segment /dev/shm/veda.<pid>, unless VEDA_ACCOUNTING=0 is set. If *cnt is
+ * larger on return than on input, only the first processes have been stored.
+ */
+VEDAresult vedaDeviceGetProcesses(VEDAprocessUsage* usage, int* cnt, VEDAdevice dev) {
+	GUARDED(
+		if(!cnt || *cnt < 0 || (*cnt && !usage))
+			VEDA_THROW(VEDA_ERROR_INVALID_VALUE);
+		*cnt = veda::Accounting::processes(usage, *cnt, veda::Devices::get(dev));
+		L_TRACE("[ve:%i] vedaDeviceGetProcesses(%p, %i, %i)", dev, usage, *cnt, dev);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Returns a VE device AUX current corresponding to VEDA Device.
@@ -450,6 +501,7 @@ VEDAresult vedaDevicePrimaryCtxReset(VEDAdevice dev) {
 	GUARDED(
 		auto& device	= veda::Devices::get(dev);
 		auto& ctx	= device.ctx();
+		ctx.prewarmWait();
 		if(ctx.isActive()) {
 			auto mode = ctx.mode();
 			ctx.destroy();
@@ -478,6 +530,7 @@ VEDAresult vedaDevicePrimaryCtxReset(VEDAdevice dev) {
 VEDAresult vedaDevicePrimaryCtxRetain(VEDAcontext* pctx, VEDAdevice dev) {
 	GUARDED(
 		*pctx = &veda::Devices::get(dev).ctx();
+		(*pctx)->prewarmWait();
 		if(!(*pctx)->isActive())
 			(*pctx)->init(VEDA_CONTEXT_MODE_OMP);
 		L_TRACE("[ve:%i] vedaDevicePrimaryCtxRetain(%i)", dev, dev);
@@ -34,8 +34,8 @@ VEDAresult vedaMemSwap(VEDAdeviceptr A, VEDAdeviceptr B) {
  */
 VEDAresult vedaMemSwapAsync(VEDAdeviceptr A, VEDAdeviceptr B, VEDAstream stream) {
 	GUARDED(
-		auto ctxA = &veda::Devices::get(A).ctx();
-		auto ctxB = &veda::Devices::get(B).ctx();
+		auto ctxA = &veda::Devices::ctx(A);
+		auto ctxB = &veda::Devices::ctx(B);
 		if(ctxA != ctxB)
 			return VEDA_ERROR_INVALID_CONTEXT;
 		L_TRACE("[ve:%i] vedaMemSwapAsync(%p, %p, %i)", ctxA->device().vedaId(), A, B, stream);
@@ -132,6 +132,65 @@ VEDAresult vedaMemAllocAsync(VEDAdeviceptr* ptr, size_t size, VEDAstream stream)
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Allocates VEDA device memory on a specific NUMA node.
+ * @param ptr Returned VEDA device pointer
+ * @param size Requested allocation size in bytes.
+ * @param placement NUMA placement of the allocation.
+ * @param node NUMA node, only used with VEDA_MEM_PLACEMENT_NODE.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_INVALID_VALUE Unknown placement or invalid node.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.
+ * @retval VEDA_ERROR_OUT_OF_MEMORY VEDA device memory exausted.\n 
+ * 
+ * Same as vedaMemAllocAsyncEx but synchronizes the context.
+ */
+VEDAresult vedaMemAllocEx(VEDAdeviceptr* ptr, size_t size, VEDAmem_placement placement, int node) {
+	CVEDA(vedaMemAllocAsyncEx(ptr, size, placement, node, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Allocates memory with stream ordered semantics on a specific NUMA
+ * node.
+ * @param ptr Returned VEDA device pointer
+ * @param size Requested allocation size in bytes.
+ * @param placement NUMA placement of the allocation.
+ * @param node NUMA node, only used with VEDA_MEM_PLACEMENT_NODE.
+ * @param stream The stream establishing the stream ordering contract and the
+ * memory pool to allocate from
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_INVALID_VALUE Unknown placement or invalid node.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.
+ * @retval VEDA_ERROR_OUT_OF_MEMORY VEDA device memory exausted.\n 
+ * 
+ * Like vedaMemAllocAsync, but controls on which NUMA node of a VE in
+ * partitioning mode the memory gets placed:\n 
+ * VEDA_MEM_PLACEMENT_DEFAULT: Uses the default policy of the VE process.\n 
+ * VEDA_MEM_PLACEMENT_LOCAL: Places the memory on the NUMA node of the device.\n 
+ * VEDA_MEM_PLACEMENT_INTERLEAVED: Interleaves the pages across all NUMA nodes,
+ * for buffers that get accessed from both partitions.\n 
+ * VEDA_MEM_PLACEMENT_NODE: Places the memory on NUMA node node.\n 
+ * On VEs that are not in partitioning mode all placements behave like
+ * VEDA_MEM_PLACEMENT_DEFAULT. The placement is a hint, small allocations can
+ * be served from memory that the VE process has already mapped.
+ */
+VEDAresult vedaMemAllocAsyncEx(VEDAdeviceptr* ptr, size_t size, VEDAmem_placement placement, int node, VEDAstream stream) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		*ptr = ctx->memAlloc(size, stream, placement, node);
+		L_TRACE("[ve:%i] vedaMemAllocAsyncEx(%p, %llu, %i, %i, %i)", ctx->device().vedaId(), *ptr, size, placement, node, stream);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Allocates host memory.
@@ -241,7 +300,7 @@ VEDAresult vedaMemFree(VEDAdeviceptr ptr) {
  */
 VEDAresult vedaMemFreeAsync(VEDAdeviceptr ptr, VEDAstream stream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(ptr).ctx();
+		auto& ctx = veda::Devices::ctx(ptr);
 		L_TRACE("[ve:%i] vedaMemFreeAsync(%p, %i)", ctx.device().vedaId(), ptr, stream);
 		ctx.memFree(ptr, stream);
 	)
@@ -285,7 +344,7 @@ VEDAresult vedaMemFreeHost(void* ptr) {
  */
 VEDAresult vedaMemGetAddressRange(VEDAdeviceptr* base, size_t* size, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(vptr).ctx();
+		auto& ctx = veda::Devices::ctx(vptr);
 		auto res = ctx.getPtr(vptr);
 		*base = VEDAptr<>(vptr).base();
 		*size = res.size;
@@ -394,7 +453,11 @@ VEDAresult vedaMemcpyDtoD(VEDAdeviceptr dstDevice, VEDAdeviceptr srcDevice, size
  *
  * Copies from device memory to device memory. dstDevice and srcDevice are the base
  * pointers of the destination and source, respectively. ByteCount specifies the
- * number of bytes to copy.
+ * number of bytes to copy.\n 
+ * Copies between different devices or between different contexts of the same
+ * device are staged through host memory and have completed when this function
+ * returns. hStream refers to the current context and is only used for the side
+ * of the copy that belongs to it, the other context uses its stream 0.
  */
 VEDAresult vedaMemcpyDtoDAsync(VEDAdeviceptr dst, VEDAdeviceptr src, size_t size, VEDAstream hStream) {
 	auto ddst = VEDA_GET_DEVICE(dst);
@@ -402,31 +465,86 @@ VEDAresult vedaMemcpyDtoDAsync(VEDAdeviceptr dst, VEDAdeviceptr src, size_t size
 
 	L_TRACE("[ve:%i>%i] vedaMemcpyDtoDAsync(%p, %p, %llu, %i)", dsrc, ddst, dst, src, size, hStream);
 
-	if(ddst == dsrc) {
+	if(ddst == dsrc && VEDA_GET_CTX(dst) == VEDA_GET_CTX(src)) {
 		GUARDED(
-			auto& ctx = veda::Devices::get(dst).ctx();
+			auto& ctx = veda::Devices::ctx(dst);
 			ctx.memcpyD2D(dst, src, size, hStream);
 		)
 	} else {
 		GUARDED(
-			auto& sctx = veda::Devices::get(src).ctx();
-			auto& dctx = veda::Devices::get(dst).ctx();
+			auto& sctx = veda::Devices::ctx(src);
+			auto& dctx = veda::Devices::ctx(dst);
+
+			// hStream belongs to the current context, the other side uses its stream 0
+			auto cur	= hStream ? veda::Contexts::current() : 0;
+			auto sstream	= cur == &sctx ? hStream : 0;
+			auto dstream	= cur == &dctx ? hStream : 0;
 
 			void* host = malloc(size);
 			if(!host)
 				VEDA_THROW(VEDA_ERROR_OUT_OF_MEMORY);
 			
-			sctx.memcpyD2H(host, src, size, 0);
-			sctx.sync(0);
+			sctx.memcpyD2H(host, src, size, sstream);
+			sctx.sync(sstream);
 
-			dctx.memcpyH2D(dst, host, size, 0);
-			dctx.sync(0);
+			dctx.memcpyH2D(dst, host, size, dstream);
+			dctx.sync(dstream);
 			
 			free(host);
 		)
 	}
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Executes a list of device memory fill and copy operations.
+ * @param ops Array of operation descriptors.
+ * @param n Number of operations.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE ops is NULL, n <= 0 or an operation has an invalid type.
+ * @retval VEDA_ERROR_INVALID_DEVICE Not all pointers belong to the same VEDA device.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS An operation exceeds the bounds of its buffers.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * See vedaMemOpsAsync.
+ */
+VEDAresult vedaMemOps(const VEDAmemop* ops, int n) {
+	CVEDA(vedaMemOpsAsync(ops, n, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Executes a list of device memory fill and copy operations asynchronously.
+ * @param ops Array of operation descriptors.
+ * @param n Number of operations.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_VALUE ops is NULL, n <= 0 or an operation has an invalid type.
+ * @retval VEDA_ERROR_INVALID_DEVICE Not all pointers belong to the same VEDA device.
+ * @retval VEDA_ERROR_OUT_OF_BOUNDS An operation exceeds the bounds of its buffers.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Executes all n operations within a single kernel launch, distributing the
+ * total number of bytes evenly across all threads of the device. All pointers
+ * need to belong to the same device and the operations must not overlap. The
+ * ops array is copied when the call gets issued and can be reused immediately.
+ */
+VEDAresult vedaMemOpsAsync(const VEDAmemop* ops, int n, VEDAstream hStream) {
+	if(ops == 0 || n <= 0)
+		return VEDA_ERROR_INVALID_VALUE;
+
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(ops[0].dst);
+		L_TRACE("[ve:%i] vedaMemOpsAsync(%p, %i, %i)", ctx.device().vedaId(), ops, n, hStream);
+		ctx.memOps(ops, n, hStream);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Copies Memory from VEDA Device to Host.
@@ -467,7 +585,7 @@ VEDAresult vedaMemcpyDtoH(void* dstHost, VEDAdeviceptr srcDevice, size_t ByteCou
  */
 VEDAresult vedaMemcpyDtoHAsync(void* dstHost, VEDAdeviceptr srcDevice, size_t ByteCount, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(srcDevice).ctx();
+		auto& ctx = veda::Devices::ctx(srcDevice);
 		L_TRACE("[ve:%i] vedaMemcpyDtoHAsync(%p, %p, %llu, %i)", ctx.device().vedaId(), dstHost, srcDevice, ByteCount, hStream);
 		ctx.memcpyD2H(dstHost, srcDevice, ByteCount, hStream);
 	)
@@ -513,7 +631,7 @@ VEDAresult vedaMemcpyHtoD(VEDAdeviceptr dstDevice, const void* srcHost, size_t B
  */
 VEDAresult vedaMemcpyHtoDAsync(VEDAdeviceptr dstDevice, const void* srcHost, size_t ByteCount, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemcpyHtoDAsync(%p, %p, %llu, %i)", ctx.device().vedaId(), dstDevice, srcHost, ByteCount, hStream);
 		ctx.memcpyH2D(dstDevice, srcHost, ByteCount, hStream);
 	)
@@ -555,7 +673,7 @@ VEDAresult vedaMemsetD16(VEDAdeviceptr dstDevice, uint16_t us, size_t N) {
  */
 VEDAresult vedaMemsetD16Async(VEDAdeviceptr dstDevice, uint16_t us, size_t N, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD16Async(%p, 0x%04X, %llu, %i)", ctx.device().vedaId(), dstDevice, (int)us, N, hStream);
 		ctx.memset(dstDevice, us, N, hStream);
 	)
@@ -599,7 +717,7 @@ VEDAresult vedaMemsetD128(VEDAdeviceptr dstDevice, uint64_t x, uint64_t y, size_
  */
 VEDAresult vedaMemsetD128Async(VEDAdeviceptr dstDevice, uint64_t x, uint64_t y, size_t N, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD128Async(%p, 0x%016llX, 0x%016llX, %llu, %i)", ctx.device().vedaId(), dstDevice, x, y, N, hStream);
 		ctx.memset(dstDevice, x, y, N, hStream);
 	)
@@ -647,7 +765,7 @@ VEDAresult vedaMemsetD2D128(VEDAdeviceptr dstDevice, size_t dstPitch, uint64_t x
  */
 VEDAresult vedaMemsetD2D128Async(VEDAdeviceptr dstDevice, size_t dstPitch, uint64_t x, uint64_t y, size_t Width, size_t Height, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD2D128Async(%p, %llu, 0x%016llX, 0x%016llX, %llu, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, x, y, Width, Height, hStream);
 		ctx.memset2D(dstDevice, dstPitch, x, y, Width, Height, hStream);
 	)
@@ -693,7 +811,7 @@ VEDAresult vedaMemsetD2D64(VEDAdeviceptr dstDevice, size_t dstPitch, uint64_t il
  */
 VEDAresult vedaMemsetD2D64Async(VEDAdeviceptr dstDevice, size_t dstPitch, uint64_t ul, size_t Width, size_t Height, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD2D64Async(%p, %llu, 0x%016llX, %llu, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, ul, Width, Height, hStream);
 		ctx.memset2D(dstDevice, dstPitch, ul, Width, Height, hStream);
 	)
@@ -743,7 +861,7 @@ VEDAresult vedaMemsetD2D16(VEDAdeviceptr dstDevice, size_t dstPitch, uint16_t us
  */
 VEDAresult vedaMemsetD2D16Async(VEDAdeviceptr dstDevice, size_t dstPitch, uint16_t us, size_t Width, size_t Height, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD2D16Async(%p, %llu, 0x%04X, %u, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, (int)us, Width, Height, hStream);
 		ctx.memset2D(dstDevice, dstPitch, us, Width, Height, hStream);
 	)
@@ -793,7 +911,7 @@ VEDAresult vedaMemsetD2D32(VEDAdeviceptr dstDevice, size_t dstPitch, uint32_t ui
  */
 VEDAresult vedaMemsetD2D32Async(VEDAdeviceptr dstDevice, size_t dstPitch, uint32_t ui, size_t Width, size_t Height, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD2D16Async(%p, %llu, 0x%08X, %llu, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, ui, Width, Height, hStream);
 		ctx.memset2D(dstDevice, dstPitch, ui, Width, Height, hStream);
 	)
@@ -843,12 +961,69 @@ VEDAresult vedaMemsetD2D8(VEDAdeviceptr dstDevice, size_t dstPitch, uint8_t uc,
  */
 VEDAresult vedaMemsetD2D8Async(VEDAdeviceptr dstDevice, size_t dstPitch, uint8_t uc, size_t Width, size_t Height, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD2D8Async(%p, %llu, 0x%02X, %llu, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, (int)uc, Width, Height, hStream);
 		ctx.memset2D(dstDevice, dstPitch, uc, Width, Height, hStream);
 	)
 }
 
+//------------------------------------------------------------------------------
+/**
+ * @brief Initializes device memory.
+ * @param dstDevice Destination device pointer.
+ * @param dstPitch Pitch of destination device pointer.
+ * @param dstSlicePitch Number of bytes between two slices.
+ * @param uc Value to set.
+ * @param Width Width of row.
+ * @param Height Number of rows.
+ * @param Depth Number of slices.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Sets the 3D memory range of Width 8-bit values to the specified value uc.
+ * Height specifies the number of rows per slice, Depth the number of slices,
+ * dstPitch the number of bytes between each row and dstSlicePitch the number
+ * of bytes between each slice.
+ */
+VEDAresult vedaMemsetD3D8(VEDAdeviceptr dstDevice, size_t dstPitch, size_t dstSlicePitch, uint8_t uc, size_t Width, size_t Height, size_t Depth) {
+	CVEDA(vedaMemsetD3D8Async(dstDevice, dstPitch, dstSlicePitch, uc, Width, Height, Depth, 0));
+	return vedaCtxSynchronize();
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Initializes device memory.
+ * @param dstDevice Destination device pointer.
+ * @param dstPitch Pitch of destination device pointer.
+ * @param dstSlicePitch Number of bytes between two slices.
+ * @param uc Value to set.
+ * @param Width Width of row.
+ * @param Height Number of rows.
+ * @param Depth Number of slices.
+ * @param hStream The stream establishing the stream ordering contract.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Sets the 3D memory range of Width 8-bit values to the specified value uc.
+ * Height specifies the number of rows per slice, Depth the number of slices,
+ * dstPitch the number of bytes between each row and dstSlicePitch the number
+ * of bytes between each slice. All rows of all slices are set within a single
+ * kernel launch.
+ */
+VEDAresult vedaMemsetD3D8Async(VEDAdeviceptr dstDevice, size_t dstPitch, size_t dstSlicePitch, uint8_t uc, size_t Width, size_t Height, size_t Depth, VEDAstream hStream) {
+	GUARDED(
+		auto& ctx = veda::Devices::ctx(dstDevice);
+		L_TRACE("[ve:%i] vedaMemsetD3D8Async(%p, %llu, %llu, 0x%02X, %llu, %llu, %llu, %i)", ctx.device().vedaId(), dstDevice, dstPitch, dstSlicePitch, (int)uc, Width, Height, Depth, hStream);
+		ctx.memset3D(dstDevice, dstPitch, dstSlicePitch, uc, Width, Height, Depth, hStream);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Initializes device memory.
@@ -885,7 +1060,7 @@ VEDAresult vedaMemsetD32(VEDAdeviceptr dstDevice, uint32_t ui, size_t N) {
  */
 VEDAresult vedaMemsetD32Async(VEDAdeviceptr dstDevice, uint32_t ui, size_t N, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD32Async(%p, 0x%08X, %llu, %i)", ctx.device().vedaId(), dstDevice, ui, N, hStream);
 		ctx.memset(dstDevice, ui, N, hStream);
 	)
@@ -927,7 +1102,7 @@ VEDAresult vedaMemsetD64(VEDAdeviceptr dstDevice, uint64_t ui, size_t N) {
  */
 VEDAresult vedaMemsetD64Async(VEDAdeviceptr dstDevice, uint64_t ul, size_t N, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD32Async(%p, 0x%016llX, %llu, %i)", ctx.device().vedaId(), dstDevice, ul, N, hStream);
 		ctx.memset(dstDevice, ul, N, hStream);
 	)
@@ -969,7 +1144,7 @@ VEDAresult vedaMemsetD8(VEDAdeviceptr dstDevice, uint8_t uc, size_t N) {
  */
 VEDAresult vedaMemsetD8Async(VEDAdeviceptr dstDevice, uint8_t uc, size_t N, VEDAstream hStream) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(dstDevice).ctx();
+		auto& ctx = veda::Devices::ctx(dstDevice);
 		L_TRACE("[ve:%i] vedaMemsetD8Async(%p, 0x%02X, %llu, %i)", ctx.device().vedaId(), dstDevice, (int)uc, N, hStream);
 		ctx.memset(dstDevice, uc, N, hStream);
 	)
@@ -1004,7 +1179,7 @@ VEDAresult vedaMemReport(void) {
  */
 VEDAresult vedaMemPtr(void** ptr, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(vptr).ctx();
+		auto& ctx = veda::Devices::ctx(vptr);
 		auto res = ctx.getPtr(vptr);
 		*ptr = (void*)res.ptr;
 		L_TRACE("[ve:%i] vedaMemPtr(%p, %p)", ctx.device().vedaId(), *ptr, vptr);
@@ -1026,7 +1201,7 @@ VEDAresult vedaMemPtr(void** ptr, VEDAdeviceptr vptr) {
  */
 VEDAresult vedaMemPtrSize(void** ptr, size_t* size, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(vptr).ctx();
+		auto& ctx = veda::Devices::ctx(vptr);
 		auto res = ctx.getPtr(vptr);
 		*ptr	= (void*)res.ptr;
 		*size	= res.size;
@@ -1048,7 +1223,7 @@ VEDAresult vedaMemPtrSize(void** ptr, size_t* size, VEDAdeviceptr vptr) {
  */
 VEDAresult vedaMemSize(size_t* size, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx = veda::Devices::get(vptr).ctx();
+		auto& ctx = veda::Devices::ctx(vptr);
 		auto res = ctx.getPtr(vptr);
 		*size	= res.size;
 		L_TRACE("[ve:%i] vedaMemSize(%llu, %p)", ctx.device().vedaId(), *size, vptr);
@@ -1069,7 +1244,7 @@ VEDAresult vedaMemSize(size_t* size, VEDAdeviceptr vptr) {
  */
 VEDAresult vedaMemHMEM(void** ptr, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx	= veda::Devices::get(vptr).ctx();
+		auto& ctx	= veda::Devices::ctx(vptr);
 		auto res	= ctx.getPtr(vptr);
 		*ptr = (void*)((veo_ptr)res.ptr | ctx.hmemId());
 		L_TRACE("[ve:%i] vedaMemHMEM(%p, %p)", ctx.device().vedaId(), *ptr, vptr);
@@ -1091,7 +1266,7 @@ VEDAresult vedaMemHMEM(void** ptr, VEDAdeviceptr vptr) {
  */
 VEDAresult vedaMemHMEMSize(void** ptr, size_t* size, VEDAdeviceptr vptr) {
 	GUARDED(
-		auto& ctx	= veda::Devices::get(vptr).ctx();
+		auto& ctx	= veda::Devices::ctx(vptr);
 		auto res	= ctx.getPtr(vptr);
 		*ptr		= (void*)((veo_ptr)res.ptr | ctx.hmemId());
 		*size		= res.size;
@@ -8,6 +8,53 @@ extern "C" {
  * To use VEDA API functions, include "veda.h" header.
  */
 /** @{ */
+//------------------------------------------------------------------------------
+/**
+ * @brief Routes the kernel launches of a stream through a persistent loop on
+ * the device.
+ * @param stream Stream to make persistent.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_UNKNOWN_STREAM stream is not a valid stream.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Kernels launched on the stream get written into a command ring in device
+ * memory, that a loop running on the VE thread of the stream polls. This
+ * avoids the latency of AVEO calls. Only launches whose arguments are all
+ * passed in registers (at most 8 arguments, no VEDAstack) go through the ring,
+ * all other operations on the stream stop the loop and get executed by AVEO.
+ * The loop gets restarted by the next eligible launch. While the loop runs, it
+ * occupies one VE core, even if the stream is idle.
+ */
+VEDAresult vedaStreamEnablePersistent(VEDAstream stream) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		L_TRACE("[ve:%i] vedaStreamEnablePersistent(%i)", ctx->device().vedaId(), stream);
+		ctx->streamSetPersistent(stream, true);
+	)
+}
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Stops the persistent loop of a stream.
+ * @param stream Stream that got made persistent with vedaStreamEnablePersistent.
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_UNKNOWN_STREAM stream is not a valid stream.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Synchronizes the stream and frees its command ring.
+ */
+VEDAresult vedaStreamDisablePersistent(VEDAstream stream) {
+	GUARDED(
+		auto ctx = veda::Contexts::current();
+		L_TRACE("[ve:%i] vedaStreamDisablePersistent(%i)", ctx->device().vedaId(), stream);
+		ctx->streamSetPersistent(stream, false);
+	)
+}
+
 //------------------------------------------------------------------------------
 /**
  * @brief Query the flags of a given stream.
@@ -218,56 +218,94 @@ veraError_t veraMemcpy2DAsync(void* dst, size_t dpitch, const void* src, size_t
 
 //------------------------------------------------------------------------------
 /**
- * @brief This function is not yet implemented. 
- * @param devPtr
- * @param pitch
- * @param value
- * @param width
- * @param height
- * @return VEDA_ERROR_NOT_IMPLEMENTED
+ * @brief Initializes or sets device memory to a value.
+ * @param devPtr Pointer to 2D device memory.
+ * @param pitch Pitch in bytes of 2D device memory.
+ * @param value Value to set for each byte of specified memory.
+ * @param width Width of matrix set (columns in bytes).
+ * @param height Height of matrix set (rows).
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Sets each byte of a matrix (height rows of width bytes each) pointed to by
+ * devPtr to the specified value. pitch is the width in bytes of the 2D array
+ * pointed to by devPtr, including any padding added to the end of each row.
  */
 veraError_t veraMemset2D(void* devPtr, size_t pitch, int value, size_t width, size_t height) {
-	return VEDA_ERROR_NOT_IMPLEMENTED;
+	CVEDA(veraInit());
+	return vedaMemsetD2D8(VERA2VEDA(devPtr), pitch, (uint8_t)value, width, height);
 }
 
 //------------------------------------------------------------------------------
 /**
- * @brief This function is not yet implemented. 
- * @param devPtr
- * @param pitch
- * @param value
- * @param width
- * @param height
- * @param stream
- * @return VEDA_ERROR_NOT_IMPLEMENTED
+ * @brief Initializes or sets device memory to a value asynchronously.
+ * @param devPtr Pointer to 2D device memory.
+ * @param pitch Pitch in bytes of 2D device memory.
+ * @param value Value to set for each byte of specified memory.
+ * @param width Width of matrix set (columns in bytes).
+ * @param height Height of matrix set (rows).
+ * @param stream Stream identifier
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Sets each byte of a matrix (height rows of width bytes each) pointed to by
+ * devPtr to the specified value. pitch is the width in bytes of the 2D array
+ * pointed to by devPtr, including any padding added to the end of each row.
  */
 veraError_t veraMemset2DAsync(void* devPtr, size_t pitch, int value, size_t width, size_t height, veraStream_t stream) {
-	return VEDA_ERROR_NOT_IMPLEMENTED;
+	CVEDA(veraInit());
+	return vedaMemsetD2D8Async(VERA2VEDA(devPtr), pitch, (uint8_t)value, width, height, stream);
 }
 
 //------------------------------------------------------------------------------
 /**
- * @brief This function is not yet implemented. 
- * @param pitchedDevPtr
- * @param value
- * @param extent
- * @return VEDA_ERROR_NOT_IMPLEMENTED
+ * @brief Initializes or sets device memory to a value.
+ * @param pitchedDevPtr Pointer to pitched device memory.
+ * @param value Value to set for each byte of specified memory.
+ * @param extent Size parameters for where to set device memory (width field in bytes).
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Initializes each element of a 3D array to the specified value. The extents
+ * of the initialized region are specified as a width in bytes, a height in
+ * rows and a depth in slices. The distance between two slices is
+ * pitchedDevPtr.pitch * pitchedDevPtr.ysize bytes.
  */
 veraError_t veraMemset3D(veraPitchedPtr pitchedDevPtr, int value, veraExtent extent) {
-	return VEDA_ERROR_NOT_IMPLEMENTED;
+	CVEDA(veraInit());
+	return vedaMemsetD3D8(VERA2VEDA(pitchedDevPtr.ptr), pitchedDevPtr.pitch, pitchedDevPtr.pitch * pitchedDevPtr.ysize, (uint8_t)value, extent.width, extent.height, extent.depth);
 }
 
 //------------------------------------------------------------------------------
 /**
- * @brief This function is not yet implemented. 
- * @param pitchedDevPtr
- * @param value
- * @param extent
- * @param stream
- * @return VEDA_ERROR_NOT_IMPLEMENTED
+ * @brief Initializes or sets device memory to a value asynchronously.
+ * @param pitchedDevPtr Pointer to pitched device memory.
+ * @param value Value to set for each byte of specified memory.
+ * @param extent Size parameters for where to set device memory (width field in bytes).
+ * @param stream Stream identifier
+ * @retval VEDA_SUCCESS on Success
+ * @retval VEDA_ERROR_NOT_INITIALIZED VEDA library not initialized
+ * @retval VEDA_ERROR_INVALID_DEVICE VEDA device id is not valid.
+ * @retval VEDA_ERROR_UNKNOWN_CONTEXT VEDA context is not set for the calling thread.
+ * @retval VEDA_ERROR_CONTEXT_IS_DESTROYED VEDA current context is already destroyed.\n 
+ *
+ * Initializes each element of a 3D array to the specified value. The extents
+ * of the initialized region are specified as a width in bytes, a height in
+ * rows and a depth in slices. The distance between two slices is
+ * pitchedDevPtr.pitch * pitchedDevPtr.ysize bytes.
  */
 veraError_t veraMemset3DAsync(veraPitchedPtr pitchedDevPtr, int value, veraExtent extent, veraStream_t stream) {
-	return VEDA_ERROR_NOT_IMPLEMENTED;
+	CVEDA(veraInit());
+	return vedaMemsetD3D8Async(VERA2VEDA(pitchedDevPtr.ptr), pitchedDevPtr.pitch, pitchedDevPtr.pitch * pitchedDevPtr.ysize, (uint8_t)value, extent.width, extent.height, extent.depth, stream);
 }
 
 //------------------------------------------------------------------------------
@@ -89,11 +89,14 @@ int main(int argc, char** argv) {
 			printf("FT_VEDA_CONTEXT_04 failed\n");
 			exit(0);
 		}
-		if( VEDA_ERROR_CANNOT_CREATE_CONTEXT != vedaCtxCreate(&cont, VEDA_CONTEXT_MODE_OMP, dev))
+		VEDAcontext second;
+		CHECK(vedaCtxCreate(&second, VEDA_CONTEXT_MODE_OMP, dev));
+		if(second == cont)
 		{
 			printf("FT_VEDA_CONTEXT_02 failed\n");
 			exit(0);
 		}
+		CHECK(vedaCtxDestroy(second));
 		CHECK(vedaCtxStreamCnt(&cnt));
 		if(cnt != 1)
 		{
@@ -109,6 +112,65 @@ int main(int argc, char** argv) {
 		printf("FT_VEDA_CONTEXT_21 failed\n");
 		exit(0);
 	}
+	printf("TEST CASE ID: FT_VEDA_CONTEXT_23\n");
+	VEDAcontext omp, scalar;
+	CHECK(vedaCtxCreate(&omp, VEDA_CONTEXT_MODE_OMP, 0));
+	CHECK(vedaCtxCreate(&scalar, VEDA_CONTEXT_MODE_SCALAR, 0));
+	if(omp == scalar)
+	{
+		printf("FT_VEDA_CONTEXT_23 failed\n");
+		exit(0);
+	}
+	CHECK(vedaCtxStreamCnt(&cnt));
+	CHECK(vedaDeviceGetAttribute(&cores,VEDA_DEVICE_ATTRIBUTE_MULTIPROCESSOR_COUNT,0));
+	if(cnt != cores)
+	{
+		printf("FT_VEDA_CONTEXT_23 failed\n");
+		exit(0);
+	}
+	const size_t elems = 1024;
+	VEDAdeviceptr pScalar, pOmp;
+	CHECK(vedaMemAlloc(&pScalar, elems * sizeof(uint32_t)));
+	CHECK(vedaMemsetD32(pScalar, 0xCAFE, elems));
+	CHECK(vedaCtxPushCurrent(omp));
+	CHECK(vedaCtxStreamCnt(&cnt));
+	if(cnt != 1)
+	{
+		printf("FT_VEDA_CONTEXT_23 failed\n");
+		exit(0);
+	}
+	CHECK(vedaMemAlloc(&pOmp, elems * sizeof(uint32_t)));
+	CHECK(vedaMemsetD32(pOmp, 0, elems));
+
+	printf("TEST CASE ID: FT_VEDA_CONTEXT_24\n");
+	if(vedaMemSwap(pOmp, pScalar) != VEDA_ERROR_INVALID_CONTEXT)
+	{
+		printf("FT_VEDA_CONTEXT_24 failed\n");
+		exit(0);
+	}
+	if(vedaMemAllocOverrideOnce(pScalar) != VEDA_ERROR_INVALID_CONTEXT)
+	{
+		printf("FT_VEDA_CONTEXT_24 failed\n");
+		exit(0);
+	}
+
+	printf("TEST CASE ID: FT_VEDA_CONTEXT_25\n");
+	std::vector<uint32_t> host(elems, 0);
+	CHECK(vedaMemcpyDtoD(pOmp, pScalar, elems * sizeof(uint32_t)));
+	CHECK(vedaMemcpyDtoH(host.data(), pOmp, elems * sizeof(uint32_t)));
+	for(size_t i = 0; i < elems; i++)
+	{
+		if(host[i] != 0xCAFE)
+		{
+			printf("FT_VEDA_CONTEXT_25 failed\n");
+			exit(0);
+		}
+	}
+	CHECK(vedaMemFree(pOmp));
+	CHECK(vedaCtxDestroy(omp));
+	CHECK(vedaMemFree(pScalar));
+	CHECK(vedaCtxDestroy(scalar));
+
     	CHECK(vedaExit());
 	printf("TEST CASE ID: FT_VEDA_CONTEXT_05\n");
       	CHECK(vedaInit(0));
@@ -2,6 +2,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cassert>
+#include <vector>
 
 #define CHECK(err) check(err, __FILE__, __LINE__)
 
@@ -109,6 +110,66 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		for(auto placement : {VEDA_MEM_PLACEMENT_LOCAL, VEDA_MEM_PLACEMENT_INTERLEAVED, VEDA_MEM_PLACEMENT_NODE}) {
+			VEDAdeviceptr placed;
+			CHECK(vedaMemAllocAsyncEx(&placed, size, placement, 0, 0));
+			CHECK(vedaMemsetD32Async(placed, 0xC0FFEE, cnt, 0));
+			CHECK(vedaMemcpyDtoHAsync(host, placed, size, 0));
+			CHECK(vedaMemFreeAsync(placed, 0));
+			CHECK(vedaCtxSynchronize());
+			printf("vedaMemAllocAsyncEx(%p, %llu, %i, %i, %i)\n", placed, size, placement, 0, 0);
+
+			for(size_t i = 0; i < cnt; i++) {
+				if(host[i] != 0xC0FFEE) {
+					printf("expected host[%i] to be %p but is %p\n", i, 0xC0FFEE, host[i]);
+					return 1;
+				}
+			}
+		}
+
+		// Allocate on both NUMA nodes of a VE in partitioning mode, which
+		// shows up as a second VEDA device with distance 0.5.
+		int remote = -1;
+		for(int other = 0; other < devcnt; other++) {
+			float distance = 1;
+			CHECK(vedaDeviceDistance(&distance, dev, other));
+			if(distance == 0.5f)
+				CHECK(vedaDeviceGetNUMAId(&remote, other));
+		}
+
+		if(remote < 0) {
+			printf("vedaMemAllocEx on NUMA nodes skipped, VE has only one NUMA node\n");
+		} else {
+			int local;
+			CHECK(vedaDeviceGetNUMAId(&local, dev));
+			for(int node : {local, remote}) {
+				VEDAdeviceptr placed;
+				CHECK(vedaMemAllocEx(&placed, size, VEDA_MEM_PLACEMENT_NODE, node));
+				printf("vedaMemAllocEx(%p, %llu, %i, %i)\n", placed, size, VEDA_MEM_PLACEMENT_NODE, node);
+				CHECK(vedaMemsetD32(placed, 0xC0FFEE + node, cnt));
+				CHECK(vedaMemcpyDtoH(host, placed, size));
+				CHECK(vedaMemFree(placed));
+
+				for(size_t i = 0; i < cnt; i++) {
+					if(host[i] != 0xC0FFEE + node) {
+						printf("expected host[%i] to be %p on node %i but is %p\n", i, 0xC0FFEE + node, node, host[i]);
+						return 1;
+					}
+				}
+			}
+		}
+
+		// Nodes and placements that do not exist
+		{
+			VEDAdeviceptr placed;
+			if(vedaMemAllocEx(&placed, size, VEDA_MEM_PLACEMENT_NODE, -1) != VEDA_ERROR_INVALID_VALUE
+			|| vedaMemAllocEx(&placed, size, VEDA_MEM_PLACEMENT_NODE, 1 << 20) != VEDA_ERROR_INVALID_VALUE
+			|| vedaMemAllocEx(&placed, size, (VEDAmem_placement)-1, 0) != VEDA_ERROR_INVALID_VALUE) {
+				printf("vedaMemAllocEx accepted an invalid node or placement\n");
+				return 1;
+			}
+		}
+
 		VEDAmodule mod;
 		const char* modName = "libveda_test.vso";
 		CHECK(vedaModuleLoad(&mod, modName));
@@ -146,6 +207,121 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		VEDAfunction reduce;
+		CHECK(vedaModuleGetFunction(&reduce, mod, "ve_test_reduce"));
+		uint64_t errors = 0;
+		CHECK(vedaLaunchKernelEx(reduce, 0, &errors, size_t(1000003)));
+		CHECK(vedaCtxSynchronize());
+		if(errors) {
+			printf("ve_test_reduce failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction sched;
+		CHECK(vedaModuleGetFunction(&sched, mod, "ve_test_sched"));
+		CHECK(vedaLaunchKernelEx(sched, 0, &errors, size_t(1000003)));
+		CHECK(vedaCtxSynchronize());
+		if(errors) {
+			printf("ve_test_sched failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction tile;
+		CHECK(vedaModuleGetFunction(&tile, mod, "ve_test_tile"));
+		CHECK(vedaLaunchKernelEx(tile, 0, &errors, size_t(1001), size_t(3001), size_t(5)));
+		CHECK(vedaCtxSynchronize());
+		if(errors) {
+			printf("ve_test_tile failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction team;
+		CHECK(vedaModuleGetFunction(&team, mod, "ve_test_team"));
+		CHECK(vedaLaunchKernelEx(team, 0, &errors, size_t(10007)));
+		CHECK(vedaCtxSynchronize());
+		if(errors) {
+			printf("ve_test_team failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction scratch;
+		CHECK(vedaModuleGetFunction(&scratch, mod, "ve_test_scratch"));
+		CHECK(vedaLaunchKernelEx(scratch, 0, &errors, size_t(1000)));
+		CHECK(vedaCtxSynchronize());
+		if(errors) {
+			printf("ve_test_scratch failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction channelFunc;
+		VEDAdeviceptr channel;
+		const size_t channelCnt = 100000;
+		CHECK(vedaModuleGetFunction(&channelFunc, mod, "ve_test_channel"));
+		if(vedaChannelCreate(&channel, sizeof(uint64_t), SIZE_MAX) != VEDA_ERROR_INVALID_VALUE
+		|| vedaChannelCreate(&channel, SIZE_MAX, 2) != VEDA_ERROR_INVALID_VALUE
+		|| vedaChannelCreate(&channel, size_t(1) << 40, size_t(1) << 40) != VEDA_ERROR_INVALID_VALUE) {
+			printf("vedaChannelCreate accepted an oversized channel\n");
+			return 1;
+		}
+		CHECK(vedaChannelCreate(&channel, sizeof(uint64_t), 256));
+		CHECK(vedaLaunchKernelEx(channelFunc, 0, &errors, VEDAptr<char>(channel).ptr(), channelCnt));
+		{
+			// the kernel blocks while the channel is full, so poll concurrently
+			std::vector<uint64_t> records(64), received(channelCnt, 0);
+			for(size_t total = 0; total < channelCnt;) {
+				size_t n = 0;
+				CHECK(vedaChannelPoll(channel, records.data(), records.size(), &n));
+				for(size_t i = 0; i < n; i++)
+					if(records[i] < channelCnt)
+						received[records[i]]++;
+				total += n;
+			}
+			CHECK(vedaCtxSynchronize());
+			for(size_t i = 0; i < channelCnt; i++)
+				if(received[i] != 1)
+					errors++;
+		}
+		CHECK(vedaMemFree(channel));
+		if(errors) {
+			printf("ve_test_channel failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		VEDAfunction add;
+		CHECK(vedaModuleGetFunction(&add, mod, "ve_test_add"));
+		CHECK(vedaStreamEnablePersistent(0));
+		{
+			const uint64_t launches = 1000;
+			std::vector<uint64_t> sums(launches, 0);
+			for(uint64_t i = 0; i < launches; i++) {
+				CHECK(vedaLaunchKernelEx(add, 0, &sums[i], i, uint64_t(7)));
+				// memcpys stop the persistent loop, the next launch restarts it
+				if(i % 100 == 0)
+					CHECK(vedaMemcpyDtoHAsync(host, ptr, sizeof(int), 0));
+			}
+			CHECK(vedaCtxSynchronize());
+			for(uint64_t i = 0; i < launches; i++)
+				if(sums[i] != i + 7)
+					errors++;
+		}
+		CHECK(vedaStreamDisablePersistent(0));
+		if(errors) {
+			printf("vedaStreamEnablePersistent failed with %llu errors\n", errors);
+			return 1;
+		}
+
+		// vedaCtxDestroy needs to stop loops that are still running
+		CHECK(vedaStreamEnablePersistent(0));
+		{
+			uint64_t sum = 0;
+			CHECK(vedaLaunchKernelEx(add, 0, &sum, uint64_t(1), uint64_t(2)));
+			CHECK(vedaStreamSynchronize(0));
+			if(sum != 3) {
+				printf("vedaStreamEnablePersistent returned %llu instead of 3\n", sum);
+				return 1;
+			}
+		}
+
 		CHECK(vedaModuleUnload(mod));
 		printf("vedaModuleUnload(%p)\n", mod);
 		CHECK(vedaMemFreeAsync(ptr, 0));
@@ -41,6 +41,26 @@ void run(VEDAcontext_mode omp, VEDAdevice device) {
 	for(VEDAstream stream : streams)			CHECK(vedaLaunchKernel(func, stream, stream));
 	for(VEDAstream stream : streams)			CHECK(vedaStreamSynchronize(stream));
 
+	VEDAfunction syncInit, sync, syncCheck;
+	CHECK(vedaModuleGetFunction(&syncInit,	mod, "ve_test_sync_init"));
+	CHECK(vedaModuleGetFunction(&sync,	mod, "ve_test_sync"));
+	CHECK(vedaModuleGetFunction(&syncCheck,	mod, "ve_test_sync_check"));
+
+	const uint64_t syncCnt = 10000;
+	CHECK(vedaLaunchKernel(syncInit, 0, num));
+	CHECK(vedaStreamSynchronize(0));
+	for(int i = 0; i < num; i++)				CHECK(vedaLaunchKernel(sync, i, i, syncCnt));
+	for(int i = 0; i < num; i++)				CHECK(vedaStreamSynchronize(i));
+
+	uint64_t errors = 0;
+	CHECK(vedaLaunchKernelEx(syncCheck, 0, &errors, num, syncCnt));
+	CHECK(vedaStreamSynchronize(0));
+	printf("vedaLaunchKernelEx(%p, %i, %llu, %i, %llu)\n", syncCheck, 0, errors, num, syncCnt);
+	if(errors) {
+		printf("ve_test_sync failed with %llu errors\n", errors);
+		exit(1);
+	}
+
 	CHECK(vedaCtxDestroy(ctx));
 }
 
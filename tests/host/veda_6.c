@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <unistd.h>
 
 #define CHECK(err) check(err, __FILE__, __LINE__)
 
@@ -51,6 +52,14 @@ int main(int argc, char** argv) {
 		CHECK(vedaDeviceGetPower(&power, dev));
 		printf("vedaDeviceGetPower(%f, %i)\n", power, dev);
 
+		VEDAtelemetry telemetry;
+		CHECK(vedaDeviceGetTelemetry(&telemetry, dev));
+		printf("vedaDeviceGetTelemetry(%fW, %i cores, %i)\n", telemetry.power, telemetry.cores, dev);
+		if(telemetry.cores != cores) {
+			printf("vedaDeviceGetTelemetry reported %i cores instead of %i\n", telemetry.cores, cores);
+			exit(1);
+		}
+
 		int value;
 		CHECK(vedaDeviceGetAttribute(&value, VEDA_DEVICE_ATTRIBUTE_CLOCK_RATE, dev));
 		printf("vedaDeviceGetAttribute(%i, VEDA_DEVICE_ATTRIBUTE_CLOCK_RATE, %i)\n", value, dev);
@@ -109,6 +118,19 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		VEDAprocessUsage usage[16];
+		int procs = 16, found = 0;
+		CHECK(vedaDeviceGetProcesses(usage, &procs, dev));
+		printf("vedaDeviceGetProcesses(%i, %i)\n", procs, dev);
+		for(int i = 0; i < procs && i < 16; i++) {
+			printf("\tpid %i: %llu bytes in %llu allocations, %llu kernels launched\n", usage[i].pid, usage[i].memUsed, usage[i].allocations, usage[i].kernelsLaunched);
+			found |= usage[i].pid == getpid();
+		}
+		if(!found) {
+			printf("vedaDeviceGetProcesses did not report this process\n");
+			return 1;
+		}
+
 		VEDAmodule mod;
 		const char* modName = "libveda_test.vso";
 		CHECK(vedaModuleLoad(&mod, modName));
@@ -0,0 +1,219 @@
+#include <veda.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cassert>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+
+#define CHECK(err) check(err, __FILE__, __LINE__)
+
+void check(VEDAresult err, const char* file, const int line) {
+	if(err != VEDA_SUCCESS) {
+		const char* name = 0;
+		vedaGetErrorName(err, &name);
+		printf("Error: %i %s @ %s (%i)\n", err, name, file, line);
+		assert(false);
+		exit(1);
+	}
+}
+
+#define EXPECT(cond, ...) if(!(cond)) { printf("FAILED: " __VA_ARGS__); printf("\n"); return 1; }
+
+/** Ordering of vedaSort: ascending, with -0.0 before +0.0. */
+template<typename T>
+bool sortLess(const T a, const T b) {
+	if constexpr (std::is_floating_point<T>::value)
+		if(a == b)
+			return std::signbit(a) && !std::signbit(b);
+	return a < b;
+}
+
+/** Sorts keys with a payload of values, and checks that the keys are ordered,
+ * that the values are a permutation of the payload and that equal keys keep
+ * their input order. */
+template<typename T>
+int testSort(const std::vector<T>& keys, const VEDAdtype dtype, const char* name) {
+	const size_t n = keys.size();
+	const uint64_t mask = 0x5555555555555555llu;
+
+	std::vector<uint64_t> values(n);
+	for(size_t i = 0; i < n; i++)
+		values[i] = i ^ mask;
+
+	VEDAdeviceptr vkeys, vvalues;
+	CHECK(vedaMemAllocAsync(&vkeys,		n * sizeof(T),		0));
+	CHECK(vedaMemAllocAsync(&vvalues,	n * sizeof(uint64_t),	0));
+	CHECK(vedaMemcpyHtoDAsync(vkeys,	keys.data(),	n * sizeof(T),		0));
+	CHECK(vedaMemcpyHtoDAsync(vvalues,	values.data(),	n * sizeof(uint64_t),	0));
+	CHECK(vedaSort(vkeys, vvalues, n, dtype));
+
+	std::vector<T> result(n);
+	CHECK(vedaMemcpyDtoH(result.data(),	vkeys,		n * sizeof(T)));
+	CHECK(vedaMemcpyDtoH(values.data(),	vvalues,	n * sizeof(uint64_t)));
+	CHECK(vedaMemFreeAsync(vkeys,	0));
+	CHECK(vedaMemFreeAsync(vvalues,	0));
+
+	std::vector<size_t> expected(n);
+	for(size_t i = 0; i < n; i++)
+		expected[i] = i;
+	std::stable_sort(expected.begin(), expected.end(), [&](const size_t a, const size_t b) { return sortLess(keys[a], keys[b]); });
+
+	std::vector<bool> seen(n, false);
+	for(size_t i = 0; i < n; i++) {
+		const uint64_t index = values[i] ^ mask;
+		EXPECT(index < n && !seen[index], "vedaSort(%s) value at %llu is not a permutation of the input", name, i);
+		seen[index] = true;
+		EXPECT(memcmp(&result[i], &keys[index], sizeof(T)) == 0, "vedaSort(%s) key at %llu does not belong to its value", name, i);
+		EXPECT(index == expected[i], "vedaSort(%s) index at %llu: %llu != %llu", name, i, index, expected[i]);
+	}
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	CHECK(vedaInit(0));
+
+	int devcnt;
+	CHECK(vedaDeviceGetCount(&devcnt));
+
+	const size_t cnt = 1000003;
+	std::vector<int32_t> host(cnt);
+	for(size_t i = 0; i < cnt; i++)
+		host[i] = int32_t((i * 7919) % 1013) - 500;
+
+	for(int dev = 0; dev < devcnt; dev++) {
+		printf("\n# ------------------------------------- #\n");
+		printf("# RUNNING TESTS ON %i                    #\n", dev);
+		printf("# ------------------------------------- #\n\n");
+
+		VEDAcontext ctx;
+		CHECK(vedaCtxCreate(&ctx, 0, dev));
+
+		VEDAdeviceptr src, dst, idx, mask, bins, pcnt;
+		CHECK(vedaMemAllocAsync(&src,	cnt * sizeof(int32_t),	0));
+		CHECK(vedaMemAllocAsync(&dst,	cnt * sizeof(int32_t),	0));
+		CHECK(vedaMemAllocAsync(&idx,	cnt * sizeof(uint64_t),	0));
+		CHECK(vedaMemAllocAsync(&mask,	cnt * sizeof(uint8_t),	0));
+		CHECK(vedaMemAllocAsync(&bins,	1013 * sizeof(uint64_t),0));
+		CHECK(vedaMemAllocAsync(&pcnt,	sizeof(uint64_t),	0));
+		CHECK(vedaMemcpyHtoDAsync(src, host.data(), cnt * sizeof(int32_t), 0));
+
+		std::vector<int32_t> result(cnt);
+
+		// Scan ------------------------------------------------------------
+		for(int inclusive = 0; inclusive < 2; inclusive++) {
+			CHECK(vedaScan(dst, src, cnt, VEDA_DTYPE_INT32, inclusive));
+			CHECK(vedaMemcpyDtoH(result.data(), dst, cnt * sizeof(int32_t)));
+			int32_t sum = 0;
+			for(size_t i = 0; i < cnt; i++) {
+				if(inclusive)	sum += host[i];
+				EXPECT(result[i] == sum, "vedaScan(inclusive=%i) at %llu: %i != %i", inclusive, i, result[i], sum);
+				if(!inclusive)	sum += host[i];
+			}
+		}
+
+		// Sort ------------------------------------------------------------
+		{
+			std::vector<uint64_t> indices(cnt);
+			for(size_t i = 0; i < cnt; i++)
+				indices[i] = i;
+			CHECK(vedaMemcpyHtoDAsync(idx, indices.data(), cnt * sizeof(uint64_t), 0));
+			CHECK(vedaMemcpyDtoDAsync(dst, src, cnt * sizeof(int32_t), 0));
+			CHECK(vedaSort(dst, idx, cnt, VEDA_DTYPE_INT32));
+			CHECK(vedaMemcpyDtoH(result.data(),	dst, cnt * sizeof(int32_t)));
+			CHECK(vedaMemcpyDtoH(indices.data(),	idx, cnt * sizeof(uint64_t)));
+
+			std::vector<size_t> expected(cnt);
+			for(size_t i = 0; i < cnt; i++)
+				expected[i] = i;
+			std::stable_sort(expected.begin(), expected.end(), [&](const size_t a, const size_t b) { return host[a] < host[b]; });
+			for(size_t i = 0; i < cnt; i++) {
+				EXPECT(indices[i] == expected[i], "vedaSort index at %llu: %llu != %llu", i, indices[i], expected[i]);
+				EXPECT(result[i] == host[expected[i]], "vedaSort key at %llu: %i != %i", i, result[i], host[expected[i]]);
+			}
+		}
+
+		// Sort Keys -------------------------------------------------------
+		{
+			const size_t n = 100003;
+			std::vector<float>	f32(n);
+			std::vector<double>	f64(n);
+			std::vector<uint64_t>	u64(n);
+			for(size_t i = 0; i < n; i++) {
+				const int64_t v = int64_t((i * 7919) % 1013) - 500;
+				f32[i] = v / 8.0f;
+				f64[i] = v / 8.0;
+				u64[i] = (i % 3 ? 0x8000000000000000llu : 0) + uint64_t(v + 500) * 0x0100000000000001llu;
+			}
+
+			// -0.0 sorts before +0.0, and both before the positive numbers
+			for(size_t i = 0; i < n; i += 97) {
+				f32[i] = (i / 97) % 2 ? -0.0f : 0.0f;
+				f64[i] = (i / 97) % 2 ? -0.0  : 0.0;
+			}
+			f32[1] = -INFINITY;	f32[2] = INFINITY;
+			f64[1] = -INFINITY;	f64[2] = INFINITY;
+			u64[1] = UINT64_MAX;	u64[2] = 0x8000000000000000llu;
+
+			if(testSort(f32, VEDA_DTYPE_FLOAT,  "float"))		return 1;
+			if(testSort(f64, VEDA_DTYPE_DOUBLE, "double"))		return 1;
+			if(testSort(u64, VEDA_DTYPE_UINT64, "uint64_t"))	return 1;
+		}
+
+		// Compact ---------------------------------------------------------
+		{
+			std::vector<uint8_t> flags(cnt);
+			std::vector<int32_t> expected;
+			for(size_t i = 0; i < cnt; i++) {
+				flags[i] = host[i] > 0;
+				if(flags[i])
+					expected.push_back(host[i]);
+			}
+			CHECK(vedaMemcpyHtoDAsync(mask, flags.data(), cnt, 0));
+			CHECK(vedaCompact(dst, src, mask, cnt, VEDA_DTYPE_INT32, pcnt));
+
+			uint64_t n = 0;
+			CHECK(vedaMemcpyDtoH(&n, pcnt, sizeof(uint64_t)));
+			EXPECT(n == expected.size(), "vedaCompact count: %llu != %llu", n, expected.size());
+			CHECK(vedaMemcpyDtoH(result.data(), dst, n * sizeof(int32_t)));
+			for(size_t i = 0; i < n; i++)
+				EXPECT(result[i] == expected[i], "vedaCompact at %llu: %i != %i", i, result[i], expected[i]);
+		}
+
+		// Histogram -------------------------------------------------------
+		{
+			const size_t nbins = 1013;
+			std::vector<uint64_t> expected(nbins, 0), hist(nbins);
+			for(size_t i = 0; i < cnt; i++)
+				if(host[i] >= 0 && size_t(host[i]) < nbins)
+					expected[host[i]]++;
+			CHECK(vedaHistogram(bins, nbins, src, cnt, VEDA_DTYPE_INT32));
+			CHECK(vedaMemcpyDtoH(hist.data(), bins, nbins * sizeof(uint64_t)));
+			for(size_t i = 0; i < nbins; i++)
+				EXPECT(hist[i] == expected[i], "vedaHistogram bin %llu: %llu != %llu", i, hist[i], expected[i]);
+
+			// empty input only clears the bins
+			CHECK(vedaHistogram(bins, nbins, src, 0, VEDA_DTYPE_INT32));
+			CHECK(vedaMemcpyDtoH(hist.data(), bins, nbins * sizeof(uint64_t)));
+			for(size_t i = 0; i < nbins; i++)
+				EXPECT(hist[i] == 0, "vedaHistogram with cnt 0, bin %llu: %llu != 0", i, hist[i]);
+		}
+
+		CHECK(vedaMemFreeAsync(src,	0));
+		CHECK(vedaMemFreeAsync(dst,	0));
+		CHECK(vedaMemFreeAsync(idx,	0));
+		CHECK(vedaMemFreeAsync(mask,	0));
+		CHECK(vedaMemFreeAsync(bins,	0));
+		CHECK(vedaMemFreeAsync(pcnt,	0));
+		CHECK(vedaCtxDestroy(ctx));
+	}
+
+	printf("\n# ------------------------------------- #\n");
+	printf("# All Tests passed!                     #\n");
+	printf("# ------------------------------------- #\n\n");
+
+	CHECK(vedaExit());
+	return 0;
+}
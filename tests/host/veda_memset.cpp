@@ -148,7 +148,165 @@ int main(int argc, char** argv) {
 			CHECK(vedaMemFreeAsync(d128, 0));
 		}
 	#endif
+
+		// Limits Tests ------------------------------------------------
+		{
+			size_t defaults[VEDA_LIMIT_CNT], value = 0;
+			for(int l = 0; l < VEDA_LIMIT_CNT; l++)
+				CHECK(vedaCtxGetLimit(&defaults[l], (VEDAlimit)l));
+
+			for(int l = 0; l < VEDA_LIMIT_CNT; l++) {
+				const size_t expected = 12345 + l;
+				CHECK(vedaCtxSetLimit((VEDAlimit)l, expected));
+				CHECK(vedaCtxGetLimit(&value, (VEDAlimit)l));
+				if(value != expected) {
+					printf("FAILED vedaCtxSetLimit(%i, %llu), vedaCtxGetLimit returned %llu\n", l, expected, value);
+					return 1;
+				}
+			}
+
+			const VEDAlimit invalid[] = {VEDA_LIMIT_CNT, (VEDAlimit)-1};
+			for(auto l : invalid) {
+				if(vedaCtxGetLimit(&value, l) != VEDA_ERROR_INVALID_VALUE || vedaCtxSetLimit(l, 0) != VEDA_ERROR_INVALID_VALUE) {
+					printf("FAILED vedaCtxGetLimit/vedaCtxSetLimit accepted VEDAlimit %i\n", l);
+					return 1;
+				}
+			}
+
+			// tuning only changes the OMP limits, within the measured range
+			// of 64kB to 64MB, unless the device runs a single thread
+			auto omp = std::getenv("VE_OMP_NUM_THREADS");
+			const bool single = omp && std::atoi(omp) == 1;
+			CHECK(vedaCtxTuneLimits());
+			for(int l = 0; l < VEDA_LIMIT_CNT; l++) {
+				CHECK(vedaCtxGetLimit(&value, (VEDAlimit)l));
+				bool tuned = l <= VEDA_LIMIT_OMP_MEMOPS && !single;
+				bool valid = tuned ? value >= 64 * 1024 && value <= 64 * 1024 * 1024 : value == size_t(12345 + l);
+				if(!valid) {
+					printf("FAILED vedaCtxTuneLimits set limit %i to %llu\n", l, value);
+					return 1;
+				}
+				printf("VEDAlimit %i: %llu\n", l, value);
+			}
+
+			size_t limitMemcpy = 0, limitMemops = 0;
+			CHECK(vedaCtxGetLimit(&limitMemcpy, VEDA_LIMIT_OMP_MEMCPY));
+			CHECK(vedaCtxGetLimit(&limitMemops, VEDA_LIMIT_OMP_MEMOPS));
+			if(limitMemcpy != limitMemops) {
+				printf("FAILED vedaCtxTuneLimits, VEDA_LIMIT_OMP_MEMOPS %llu != VEDA_LIMIT_OMP_MEMCPY %llu\n", limitMemops, limitMemcpy);
+				return 1;
+			}
+
+			for(int l = 0; l < VEDA_LIMIT_CNT; l++)
+				CHECK(vedaCtxSetLimit((VEDAlimit)l, defaults[l]));
+		}
+
+		// MemOps Tests ------------------------------------------------
+		{
+			// one size below and one above VEDA_LIMIT_OMP_MEMOPS, so both
+			// the serial and the split parallel execution get checked
+			size_t ompLimit = 0;
+			CHECK(vedaCtxGetLimit(&ompLimit, VEDA_LIMIT_OMP_MEMOPS));
+			const size_t halo = 37;
+			const size_t inners[] = {1000, std::max(ompLimit, (size_t)(2 * 1024 * 1024)) + 1001};
+			for(auto inner : inners) {
+				const size_t total = halo + inner + halo;
+				VEDAdeviceptr src, dst;
+				CHECK(vedaMemAllocAsync(&src, inner,	0));
+				CHECK(vedaMemAllocAsync(&dst, total,	0));
+				CHECK(vedaMemsetD8Async(src, 0x12, inner, 0));
+
+				VEDAmemop ops[] = {
+					{VEDA_MEMOP_MEMSET_U8,	dst,			0,	0xFF,	halo},
+					{VEDA_MEMOP_MEMCPY,	dst + halo,		src,	0,	inner},
+					{VEDA_MEMOP_MEMSET_U8,	dst + halo + inner,	0,	0xFF,	halo}
+				};
+				CHECK(vedaMemOpsAsync(ops, sizeof(ops) / sizeof(VEDAmemop), 0));
+
+				auto host = (uint8_t*)malloc(total);
+				CHECK(vedaMemcpyDtoH(host, dst, total));
+				for(size_t i = 0; i < total; i++) {
+					uint8_t expected = (i < halo || i >= (halo + inner)) ? 0xFF : 0x12;
+					if(host[i] != expected) {
+						printf("FAILED vedaMemOpsAsync(%llu bytes), expected %02X but found %02X at %llu\n", total, expected, host[i], i);
+						return 1;
+					}
+				}
+
+				free(host);
+				CHECK(vedaMemFreeAsync(src, 0));
+				CHECK(vedaMemFreeAsync(dst, 0));
+			}
+		}
 	
+		// Unaligned Memcpy Tests --------------------------------------
+		{
+			const size_t bytes = 64 * 1024 * 1024 + 13;
+			const size_t pad   = 8;
+			auto host = (uint8_t*)malloc(bytes + pad);
+			auto back = (uint8_t*)malloc(bytes + pad);
+			for(size_t i = 0; i < bytes + pad; i++)
+				host[i] = (uint8_t)(i * 7 + 3);
+
+			VEDAdeviceptr A, B;
+			CHECK(vedaMemAllocAsync(&A, bytes + pad, 0));
+			CHECK(vedaMemAllocAsync(&B, bytes + pad, 0));
+			CHECK(vedaMemcpyHtoDAsync(B, host, bytes + pad, 0));
+
+			// one size each for the serial, the parallel and the non-temporal
+			// copy, all with a misaligned tail
+			size_t ompLimit = 0, ntLimit = 0;
+			CHECK(vedaCtxGetLimit(&ompLimit, VEDA_LIMIT_OMP_MEMCPY));
+			CHECK(vedaCtxGetLimit(&ntLimit,  VEDA_LIMIT_NONTEMPORAL));
+			const size_t upper	= std::min(ntLimit, bytes);
+			const size_t serial	= std::min(ompLimit, upper) / 2 + 13;
+			const size_t parallel	= ompLimit + 26 < upper ? (ompLimit + upper) / 2 + 13 : serial;
+			const size_t benchmarks[] = {serial, parallel, bytes};
+			double baseline[] = {0, 0, 0};
+
+			// {0, 0} needs to be first, as it is the baseline of the benchmark
+			const size_t offsets[][2] = {{0, 0}, {1, 1}, {0, 1}, {1, 0}, {3, 5}, {7, 2}};
+			for(auto& o : offsets) {
+				const size_t sizes[] = {0, 1, 7, 9, 4095, serial, parallel, bytes};
+				for(auto size : sizes) {
+					CHECK(vedaMemsetD8Async(A, 0, bytes + pad, 0));
+					CHECK(vedaMemcpyDtoD(A + o[0], B + o[1], size));
+					CHECK(vedaMemcpyDtoH(back, A, bytes + pad));
+					for(size_t i = 0; i < bytes + pad; i++) {
+						uint8_t expected = (i >= o[0] && i < o[0] + size) ? host[i - o[0] + o[1]] : 0;
+						if(back[i] != expected) {
+							printf("FAILED vedaMemcpyDtoD(dst+%llu, src+%llu, %llu), expected %02X but found %02X at %llu\n", o[0], o[1], size, expected, back[i], i);
+							return 1;
+						}
+					}
+				}
+
+				for(size_t b = 0; b < sizeof(benchmarks) / sizeof(size_t); b++) {
+					const size_t size = benchmarks[b];
+					double min = DBL_MAX;
+					double max = 0;
+					double sum = 0;
+					for(int i = 0; i < RUNS; i++){
+						auto start = time_ns();
+						CHECK(vedaMemcpyDtoD(A + o[0], B + o[1], size));
+						auto end = time_ns();
+						auto time = (end - start) / 1000.0;
+						min = std::min(min, time);
+						max = std::max(max, time);
+						sum += time;
+					}
+					if(o[0] == 0 && o[1] == 0)
+						baseline[b] = min;
+					printf("%-15sbytes: %8.2fMB, dst+%llu, src+%llu, min: %8.2f ms, avg: %8.2f, max: %8.2f ms, %6.2f GB/s, %5.2fx of aligned\n", "vedaMemcpyDtoD", size/1024.0/1024.0, o[0], o[1], min, sum/RUNS, max, size/1024.0/1024.0/1024.0/(min/1000.0/1000.0), baseline[b] / min);
+				}
+			}
+
+			CHECK(vedaMemFreeAsync(A, 0));
+			CHECK(vedaMemFreeAsync(B, 0));
+			free(host);
+			free(back);
+		}
+
 		// Memcpy Tests ------------------------------------------------
 		const double MB[] = {0.1, 0.2, 0.4, 0.8, 1, 2, 3, 4, 8, 16, 32, 64, 128, 256};
 
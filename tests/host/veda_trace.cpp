@@ -0,0 +1,192 @@
+#include <veda.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <cctype>
+#include <string>
+#include <algorithm>
+#include <unistd.h>
+
+#define CHECK(err) check(err, __FILE__, __LINE__)
+
+void check(VEDAresult err, const char* file, const int line) {
+	if(err != VEDA_SUCCESS) {
+		const char* name = 0;
+		vedaGetErrorName(err, &name);
+		printf("Error: %i %s @ %s (%i)\n", err, name, file, line);
+		assert(false);
+		exit(1);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Minimal JSON validator
+//------------------------------------------------------------------------------
+static bool jsonValue(const char*& p);
+
+static void jsonSkip(const char*& p) {
+	while(isspace((unsigned char)*p))
+		p++;
+}
+
+static bool jsonString(const char*& p) {
+	if(*p++ != '"')
+		return false;
+	for(; *p && *p != '"'; p++)
+		if(*p == '\\' && !*++p)
+			return false;
+	return *p++ == '"';
+}
+
+static bool jsonNumber(const char*& p) {
+	char* end = 0;
+	strtod(p, &end);
+	if(end == p)
+		return false;
+	p = end;
+	return true;
+}
+
+static bool jsonList(const char*& p, const char close, const bool object) {
+	p++;
+	jsonSkip(p);
+	if(*p == close)
+		return *p++ == close;
+	for(;;) {
+		jsonSkip(p);
+		if(object) {
+			if(!jsonString(p))
+				return false;
+			jsonSkip(p);
+			if(*p++ != ':')
+				return false;
+		}
+		if(!jsonValue(p))
+			return false;
+		jsonSkip(p);
+		if(*p == close)
+			return *p++ == close;
+		if(*p++ != ',')
+			return false;
+	}
+}
+
+static bool jsonValue(const char*& p) {
+	jsonSkip(p);
+	switch(*p) {
+		case '{':	return jsonList(p, '}', true);
+		case '[':	return jsonList(p, ']', false);
+		case '"':	return jsonString(p);
+		case 't':	return strncmp(p, "true",  4) == 0 ? (p += 4, true) : false;
+		case 'f':	return strncmp(p, "false", 5) == 0 ? (p += 5, true) : false;
+		case 'n':	return strncmp(p, "null",  4) == 0 ? (p += 4, true) : false;
+	}
+	return jsonNumber(p);
+}
+
+//------------------------------------------------------------------------------
+static bool contains(const std::string& json, const char* event) {
+	return json.find(event) != std::string::npos;
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+	char file[] = "/tmp/veda_trace_XXXXXX.json";
+	int fd = mkstemps(file, 5);
+	if(fd < 0) {
+		printf("Unable to create temporary trace file\n");
+		return 1;
+	}
+	close(fd);
+	setenv("VEDA_TRACE", file, 1);
+
+	CHECK(vedaInit(0));
+
+	int devcnt;
+	CHECK(vedaDeviceGetCount(&devcnt));
+	if(devcnt == 0) {
+		printf("No VEDA device found\n");
+		return 1;
+	}
+
+	VEDAcontext ctx;
+	CHECK(vedaCtxCreate(&ctx, 0, 0));
+
+	VEDAmodule mod;
+	CHECK(vedaModuleLoad(&mod, "libveda_test.vso"));
+	VEDAfunction add;
+	CHECK(vedaModuleGetFunction(&add, mod, "ve_test_add"));
+
+	uint64_t host = 42, sum = 0;
+	VEDAdeviceptr ptr;
+	CHECK(vedaMemAllocAsync(&ptr, sizeof(uint64_t), 0));
+	CHECK(vedaMemcpyHtoDAsync(ptr, &host, sizeof(uint64_t), 0));
+	CHECK(vedaLaunchKernelEx(add, 0, &sum, uint64_t(1), uint64_t(2)));
+	CHECK(vedaMemcpyDtoHAsync(&host, ptr, sizeof(uint64_t), 0));
+	CHECK(vedaCtxSynchronize());
+	if(sum != 3 || host != 42) {
+		printf("ve_test_add returned %llu, memcpy returned %llu\n", sum, host);
+		return 1;
+	}
+
+	// kernels of persistent streams additionally report their device cycles
+	CHECK(vedaStreamEnablePersistent(0));
+	for(uint64_t i = 0; i < 16; i++)
+		CHECK(vedaLaunchKernelEx(add, 0, &sum, i, uint64_t(7)));
+	CHECK(vedaStreamSynchronize(0));
+	CHECK(vedaStreamDisablePersistent(0));
+	if(sum != 22) {
+		printf("ve_test_add on a persistent stream returned %llu instead of 22\n", sum);
+		return 1;
+	}
+
+	CHECK(vedaMemFreeAsync(ptr, 0));
+	CHECK(vedaModuleUnload(mod));
+	CHECK(vedaCtxDestroy(ctx));
+
+	// the trace gets written in vedaExit
+	CHECK(vedaExit());
+
+	std::string json;
+	if(auto f = fopen(file, "r")) {
+		char buffer[4096];
+		size_t n;
+		while((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+			json.append(buffer, n);
+		fclose(f);
+	}
+	unlink(file);
+
+	const char* p = json.c_str();
+	if(!jsonValue(p) || (jsonSkip(p), *p != 0)) {
+		printf("FAILED %s is not valid JSON at offset %llu\n", file, (unsigned long long)(p - json.c_str()));
+		return 1;
+	}
+
+	const char* events[] = {
+		"\"name\":\"vedaLaunchKernelEx\"",
+		"\"name\":\"kernel\"",
+		"\"name\":\"wait\""
+	};
+	for(auto event : events) {
+		if(!contains(json, event)) {
+			printf("FAILED VEDA_TRACE does not contain %s\n", event);
+			return 1;
+		}
+	}
+
+	uint64_t maxCycles = 0;
+	for(auto pos = json.find("\"cycles\":"); pos != std::string::npos; pos = json.find("\"cycles\":", pos + 1))
+		maxCycles = std::max(maxCycles, (uint64_t)strtoull(json.c_str() + pos + 9, 0, 10));
+	if(maxCycles == 0) {
+		printf("FAILED VEDA_TRACE does not report cycles for kernels of a persistent stream\n");
+		return 1;
+	}
+
+	printf("\n# ------------------------------------- #\n");
+	printf("# All Tests passed!                     #\n");
+	printf("# ------------------------------------- #\n\n");
+
+	return 0;
+}
@@ -102,6 +102,42 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		{
+			veraExtent extent = {3, 5, 7};	// depth, height, width
+			size_t pitch = 16, ysize = 6;
+			size_t bytes = pitch * ysize * extent.depth;
+			void* vol;
+			CHECK(veraMallocAsync(&vol, bytes, 0));
+			CHECK(veraMemsetAsync(vol, 0, bytes / sizeof(int), 0));
+			veraPitchedPtr pptr = {pitch, vol, extent.width, ysize};
+			CHECK(veraMemset3DAsync(pptr, 0xAB, extent, 0));
+			printf("veraMemset3DAsync(%p, %02X, {%llu, %llu, %llu}, %i)\n", vol, 0xAB, extent.width, extent.height, extent.depth, 0);
+			CHECK(veraMemset2DAsync(vol, pitch, 0xCD, 2, 1, 0));
+			printf("veraMemset2DAsync(%p, %llu, %02X, %llu, %llu, %i)\n", vol, pitch, 0xCD, 2, 1, 0);
+
+			auto vhost = (uint8_t*)malloc(bytes);
+			CHECK(veraMemcpyAsync(vhost, vol, bytes, veraMemcpyDeviceToHost, 0));
+			CHECK(veraDeviceSynchronize());
+
+			for(size_t z = 0; z < extent.depth; z++) {
+				for(size_t y = 0; y < ysize; y++) {
+					for(size_t x = 0; x < pitch; x++) {
+						auto idx	= z * pitch * ysize + y * pitch + x;
+						uint8_t expected = (y < extent.height && x < extent.width) ? 0xAB : 0x00;
+						if(idx < 2)
+							expected = 0xCD;
+						if(vhost[idx] != expected) {
+							printf("expected vol[%llu, %llu, %llu] to be %02X but is %02X\n", z, y, x, expected, vhost[idx]);
+							return 1;
+						}
+					}
+				}
+			}
+
+			free(vhost);
+			CHECK(veraFreeAsync(vol, 0));
+		}
+
 		veraModule_t mod;
 		const char* modName = "libveda_test.vso";
 		CHECK(veraModuleLoad(&mod, modName));